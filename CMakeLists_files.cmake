@@ -116,6 +116,7 @@ list (APPEND MAIN_SOURCE_FILES
   opm/models/io/restart.cpp
   opm/models/nonlinear/newtonmethodparams.cpp
   opm/models/parallel/tasklets.cpp
+  opm/models/parallel/taskpool.cpp
   opm/models/parallel/threadmanager.cpp
   opm/models/tpsa/tpsanewtonmethodparams.cpp
   opm/models/utils/parametersystem.cpp
@@ -203,6 +204,7 @@ list (APPEND MAIN_SOURCE_FILES
   opm/simulators/timestepping/TimeStepControl.cpp
   opm/simulators/timestepping/gatherConvergenceReport.cpp
   opm/simulators/utils/ComponentName.cpp
+  opm/simulators/utils/DeckCache.cpp
   opm/simulators/utils/DeferredLogger.cpp
   opm/simulators/utils/FullySupportedFlowKeywords.cpp
   opm/simulators/utils/ParallelFileMerger.cpp
@@ -210,10 +212,13 @@ list (APPEND MAIN_SOURCE_FILES
   opm/simulators/utils/PartiallySupportedFlowKeywords.cpp
   opm/simulators/utils/PressureAverage.cpp
   opm/simulators/utils/SerializationPackers.cpp
+  opm/simulators/utils/TimeBlockProfiler.cpp
+  opm/simulators/utils/TimeBlockReport.cpp
   opm/simulators/utils/UnsupportedFlowKeywords.cpp
   opm/simulators/utils/compressPartition.cpp
   opm/simulators/utils/gatherDeferredLogger.cpp
   opm/simulators/utils/readDeck.cpp
+  opm/simulators/utils/sumMaxReduction.cpp
   opm/simulators/utils/satfunc/GasPhaseConsistencyChecks.cpp
   opm/simulators/utils/satfunc/OilPhaseConsistencyChecks.cpp
   opm/simulators/utils/satfunc/PhaseCheckBase.cpp
@@ -244,6 +249,7 @@ list (APPEND MAIN_SOURCE_FILES
   opm/simulators/wells/GroupEconomicLimitsChecker.cpp
   opm/simulators/wells/GroupState.cpp
   opm/simulators/wells/GroupStateHelper.cpp
+  opm/simulators/wells/GroupTopology.cpp
   opm/simulators/wells/MSWellHelpers.cpp
   opm/simulators/wells/MultisegmentWellAssemble.cpp
   opm/simulators/wells/MultisegmentWellEquations.cpp
@@ -251,6 +257,7 @@ list (APPEND MAIN_SOURCE_FILES
   opm/simulators/wells/MultisegmentWellGeneric.cpp
   opm/simulators/wells/MultisegmentWellPrimaryVariables.cpp
   opm/simulators/wells/MultisegmentWellSegments.cpp
+  opm/simulators/wells/MultisegmentWellTreeSolver.cpp
   opm/simulators/wells/ParallelPAvgCalculator.cpp
   opm/simulators/wells/ParallelPAvgDynamicSourceData.cpp
   opm/simulators/wells/ParallelWBPCalculation.cpp
@@ -478,11 +485,13 @@ list (APPEND TEST_SOURCE_FILES
   tests/models/test_propertysystem.cpp
   tests/models/test_tasklets.cpp
   tests/models/test_tasklets_failure.cpp
+  tests/models/test_taskpool.cpp
   tests/test_ALQState.cpp
   tests/test_aquifergridutils.cpp
   tests/test_blackoil_amg.cpp
   tests/test_convergenceoutputconfiguration.cpp
   tests/test_convergencereport.cpp
+  tests/test_DeckCache.cpp
   tests/test_deferredlogger.cpp
   tests/test_dilu.cpp
   tests/test_group_higher_constraints.cpp
@@ -494,6 +503,7 @@ list (APPEND TEST_SOURCE_FILES
   tests/test_glift1.cpp
   tests/test_graphcoloring.cpp
   tests/test_GroupState.cpp
+  tests/test_GroupTopology.cpp
   tests/test_injection_topup_phase_validation.cpp
   tests/test_interregflows.cpp
   tests/test_invert.cpp
@@ -501,6 +511,7 @@ list (APPEND TEST_SOURCE_FILES
   tests/test_LogOutputHelper.cpp
   tests/test_milu.cpp
   tests/test_multmatrixtransposed.cpp
+  tests/test_MultisegmentWellTreeSolver.cpp
   tests/test_nonnc.cpp
   tests/test_norne_pvt.cpp
   tests/test_OilSatfuncConsistencyChecks.cpp
@@ -524,10 +535,12 @@ list (APPEND TEST_SOURCE_FILES
   tests/test_SatfuncConsistencyCheckManager.cpp
   tests/test_stoppedwells.cpp
   tests/test_ThreePointHorizontalSatfuncConsistencyChecks.cpp
+  tests/test_TimeBlockProfiler.cpp
   tests/test_timer.cpp
   tests/test_tpsa_face_properties.cpp
   tests/test_tpsa_localresidual.cpp
   tests/test_tpsa_primaryvariables.cpp
+  tests/test_TransmissibilityCompact.cpp
   tests/test_vfpproperties.cpp
   tests/test_WaterSatfuncConsistencyChecks.cpp
   tests/test_wellmodel.cpp
@@ -730,6 +743,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/models/blackoil/blackoilfoamparams.hpp
   opm/models/blackoil/blackoilvariableandequationindices.hh
   opm/models/blackoil/blackoilintensivequantities.hh
+  opm/models/blackoil/blackoilintensivequantitiessoa.hh
   opm/models/blackoil/blackoillocalresidual.hh
   opm/models/blackoil/blackoillocalresidualtpfa.hh
   opm/models/blackoil/blackoilmeanings.hh
@@ -882,11 +896,13 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/models/parallel/gridcommhandles.hh
   opm/models/parallel/mpibuffer.hh
   opm/models/parallel/tasklets.hpp
+  opm/models/parallel/taskpool.hpp
   opm/models/parallel/threadedentityiterator.hh
   opm/models/parallel/threadmanager.hpp
   opm/models/ptflash/flashindices.hh
   opm/models/ptflash/flashintensivequantities.hh
   opm/models/ptflash/flashlocalresidual.hh
+  opm/models/ptflash/flashlocalresidualtpfa.hh
   opm/models/ptflash/flashmodel.hh
   opm/models/ptflash/flashnewtonmethod.hh
   opm/models/ptflash/flashparameters.hh
@@ -1139,6 +1155,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/timestepping/SimulatorTimerInterface.hpp
   opm/simulators/timestepping/gatherConvergenceReport.hpp
   opm/simulators/utils/ComponentName.hpp
+  opm/simulators/utils/DeckCache.hpp
   opm/simulators/utils/DeferredLogger.hpp
   opm/simulators/utils/DeferredLoggingErrorHelpers.hpp
   opm/simulators/utils/ParallelEclipseState.hpp
@@ -1148,6 +1165,9 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/utils/PressureAverage.hpp
   opm/simulators/utils/PropsDataHandle.hpp
   opm/simulators/utils/SerializationPackers.hpp
+  opm/simulators/utils/TimeBlockProfiler.hpp
+  opm/simulators/utils/TimeBlockProfilerMacros.hpp
+  opm/simulators/utils/TimeBlockReport.hpp
   opm/simulators/utils/VectorVectorDataHandle.hpp
   opm/simulators/utils/compressPartition.hpp
   opm/simulators/utils/gatherDeferredLogger.hpp
@@ -1155,6 +1175,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/utils/ParallelCommunication.hpp
   opm/simulators/utils/ParallelSerialization.hpp
   opm/simulators/utils/readDeck.hpp
+  opm/simulators/utils/sumMaxReduction.hpp
   opm/simulators/utils/satfunc/GasPhaseConsistencyChecks.hpp
   opm/simulators/utils/satfunc/OilPhaseConsistencyChecks.hpp
   opm/simulators/utils/satfunc/PhaseCheckBase.hpp
@@ -1196,6 +1217,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/wells/GroupEconomicLimitsChecker.hpp
   opm/simulators/wells/GroupState.hpp
   opm/simulators/wells/GroupStateHelper.hpp
+  opm/simulators/wells/GroupTopology.hpp
   opm/simulators/wells/GuideRateHandler.hpp
   opm/simulators/wells/MSWellHelpers.hpp
   opm/simulators/wells/MultisegmentWell.hpp
@@ -1206,6 +1228,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/wells/MultisegmentWellGeneric.hpp
   opm/simulators/wells/MultisegmentWellPrimaryVariables.hpp
   opm/simulators/wells/MultisegmentWellSegments.hpp
+  opm/simulators/wells/MultisegmentWellTreeSolver.hpp
   opm/simulators/wells/ParallelPAvgCalculator.hpp
   opm/simulators/wells/ParallelPAvgDynamicSourceData.hpp
   opm/simulators/wells/ParallelWBPCalculation.hpp
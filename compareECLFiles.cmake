@@ -71,12 +71,14 @@ endfunction()
 #
 # Details:
 #   - This test class compares output from a simulation to reference files.
+#   - REF_SIMULATOR selects the reference files of another simulator.
 function(add_test_compareECLFiles)
   set(oneValueArgs
     CASENAME
     FILENAME
     DEV_SIMULATOR
     SIMULATOR
+    REF_SIMULATOR
     ABS_TOL
     REL_TOL
     DIR
@@ -109,7 +111,11 @@ function(add_test_compareECLFiles)
   if(PARAM_RESTART_SCHED STREQUAL "false" OR PARAM_RESTART_SCHED STREQUAL "true")
     list(APPEND DRIVER_ARGS -h ${PARAM_RESTART_SCHED})
   endif()
-  list(APPEND DRIVER_ARGS -u ${PARAM_SIMULATOR})
+  if(PARAM_REF_SIMULATOR)
+    list(APPEND DRIVER_ARGS -u ${PARAM_REF_SIMULATOR})
+  else()
+    list(APPEND DRIVER_ARGS -u ${PARAM_SIMULATOR})
+  endif()
   if(USE_DEV_SIMULATOR_IN_TESTS AND PARAM_DEV_SIMULATOR)
     set(PARAM_SIMULATOR ${PARAM_DEV_SIMULATOR})
   endif()
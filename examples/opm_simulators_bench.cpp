@@ -0,0 +1,645 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Micro-benchmarks for the performance critical kernels of flow.
+ *
+ * The program times the TPFA linearizer, the update of the cached
+ * intensive quantities, the setup and application of the ILU0, DILU
+ * and CPR preconditioners, the assembly of standard wells and the
+ * interpolation in VFP tables. The kernels are run on a synthetic
+ * Cartesian case and on any number of decks given on the command line,
+ * and the timings are written as JSON so that they can be compared
+ * between builds.
+ *
+ * Usage:
+ *
+ *   opm-simulators-bench [--repetitions=N] [--threads=N]
+ *                        [--cartesian-size=NX,NY,NZ] [--output=FILE]
+ *                        [DECK.DATA ...]
+ */
+#include <config.h>
+
+#include <opm/material/common/ResetLocale.hpp>
+
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/VFPProdTable.hpp>
+
+#include <opm/models/blackoil/blackoillocalresidualtpfa.hh>
+#include <opm/models/discretization/common/tpfalinearizer.hh>
+#include <opm/models/utils/parametersystem.hpp>
+#include <opm/models/utils/start.hh>
+
+#include <opm/simulators/flow/BlackoilModel.hpp>
+#include <opm/simulators/flow/BlackoilModelParameters.hpp>
+#include <opm/simulators/flow/FlowGenericVanguard.hpp>
+#include <opm/simulators/linalg/FlowLinearSolverParameters.hpp>
+#include <opm/simulators/linalg/ISTLSolver.hpp>
+#include <opm/simulators/linalg/matrixblock.hh>
+#include <opm/simulators/linalg/PreconditionerFactory.hpp>
+#include <opm/simulators/linalg/PropertyTree.hpp>
+#include <opm/simulators/linalg/getQuasiImpesWeights.hpp>
+#include <opm/simulators/linalg/setupPropertyTree.hpp>
+#include <opm/simulators/timestepping/EclTimeSteppingParams.hpp>
+#include <opm/simulators/wells/StandardWell.hpp>
+#include <opm/simulators/wells/VFPHelpers.hpp>
+
+#include <dune/common/fvector.hh>
+#include <dune/common/parallel/mpihelper.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+#include <dune/istl/operators.hh>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Opm::Properties {
+
+namespace TTag {
+
+// Same setup as the default blackoil variant of flow, i.e. the TPFA
+// linearizer without ElementContext.
+struct FlowBenchmarkProblem
+{
+    using InheritsFrom = std::tuple<FlowProblem>;
+};
+
+}
+
+template<class TypeTag>
+struct Linearizer<TypeTag, TTag::FlowBenchmarkProblem>
+{ using type = TpfaLinearizer<TypeTag>; };
+
+template<class TypeTag>
+struct LocalResidual<TypeTag, TTag::FlowBenchmarkProblem>
+{ using type = BlackOilLocalResidualTPFA<TypeTag>; };
+
+template<class TypeTag>
+struct EnableDiffusion<TypeTag, TTag::FlowBenchmarkProblem>
+{ static constexpr bool value = false; };
+
+template<class TypeTag>
+struct AvoidElementContext<TypeTag, TTag::FlowBenchmarkProblem>
+{ static constexpr bool value = true; };
+
+} // namespace Opm::Properties
+
+namespace {
+
+struct Options
+{
+    int repetitions = 10;
+    int threads = 1;
+    std::array<int, 3> cartesianSize { 20, 20, 10 };
+    std::string output;
+    std::vector<std::string> decks;
+};
+
+struct BenchmarkResult
+{
+    std::string kernel;
+    std::string caseName;
+    std::size_t size = 0;
+    std::vector<double> samples;
+};
+
+class Harness
+{
+public:
+    explicit Harness(int repetitions)
+        : repetitions_(std::max(repetitions, 1))
+    {}
+
+    /// Run \p fn once to warm up caches and lazily allocated storage,
+    /// then record the wall clock time of each of the repetitions.
+    template <class Function>
+    void run(const std::string& kernel,
+             const std::string& caseName,
+             std::size_t size,
+             Function&& fn)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        BenchmarkResult result { kernel, caseName, size, {} };
+        result.samples.reserve(repetitions_);
+
+        fn();
+        for (int rep = 0; rep < repetitions_; ++rep) {
+            const auto start = Clock::now();
+            fn();
+            const auto stop = Clock::now();
+            result.samples.push_back(std::chrono::duration<double>(stop - start).count());
+        }
+
+        std::cerr << "  " << std::left << std::setw(40) << kernel
+                  << std::right << std::setw(14) << std::scientific << std::setprecision(4)
+                  << median(result.samples) << " s  (" << caseName << ")\n";
+
+        results_.push_back(std::move(result));
+    }
+
+    void writeJson(std::ostream& os, const Options& options) const
+    {
+        os << "{\n"
+           << "  \"benchmark\": \"opm-simulators-bench\",\n"
+           << "  \"repetitions\": " << repetitions_ << ",\n"
+           << "  \"threads\": " << options.threads << ",\n"
+           << "  \"results\": [";
+
+        os << std::setprecision(9) << std::scientific;
+        for (std::size_t i = 0; i < results_.size(); ++i) {
+            const auto& r = results_[i];
+            const auto [min, max] = std::minmax_element(r.samples.begin(), r.samples.end());
+            const double mean = std::accumulate(r.samples.begin(), r.samples.end(), 0.0)
+                / r.samples.size();
+
+            os << (i == 0 ? "\n" : ",\n")
+               << "    {\"kernel\": " << quoted(r.kernel)
+               << ", \"case\": " << quoted(r.caseName)
+               << ", \"size\": " << r.size
+               << ", \"min_s\": " << *min
+               << ", \"median_s\": " << median(r.samples)
+               << ", \"mean_s\": " << mean
+               << ", \"max_s\": " << *max << "}";
+        }
+        os << "\n  ]\n}\n";
+    }
+
+private:
+    static double median(std::vector<double> samples)
+    {
+        const auto mid = samples.begin() + samples.size() / 2;
+        std::nth_element(samples.begin(), mid, samples.end());
+        return *mid;
+    }
+
+    static std::string quoted(std::string_view s)
+    {
+        std::string q = "\"";
+        for (const char c : s) {
+            if (c == '"' || c == '\\') {
+                q += '\\';
+            }
+            q += c;
+        }
+        return q + '"';
+    }
+
+    int repetitions_;
+    std::vector<BenchmarkResult> results_;
+};
+
+// ----------------- Preconditioners -----------------
+
+constexpr int blockSize = 3;
+using Matrix = Dune::BCRSMatrix<Opm::MatrixBlock<double, blockSize, blockSize>>;
+using Vector = Dune::BlockVector<Dune::FieldVector<double, blockSize>>;
+
+/// Seven point stencil on a Cartesian grid with blocks which are
+/// diagonally dominant and have a pressure-like first equation.
+Matrix syntheticMatrix(const std::array<int, 3>& dims)
+{
+    const auto [nx, ny, nz] = dims;
+    const std::size_t n = static_cast<std::size_t>(nx) * ny * nz;
+
+    Matrix A(n, n, 7, 0.4, Matrix::implicit);
+    auto cellIdx = [nx = nx, ny = ny](int i, int j, int k)
+    { return static_cast<std::size_t>(i + nx * (j + ny * k)); };
+
+    typename Matrix::block_type offDiag(0.0);
+    for (int eq = 0; eq < blockSize; ++eq) {
+        offDiag[eq][eq] = -1.0;
+        offDiag[eq][0] = -0.1;
+    }
+    offDiag[0][0] = -1.0;
+
+    for (int k = 0; k < nz; ++k) {
+        for (int j = 0; j < ny; ++j) {
+            for (int i = 0; i < nx; ++i) {
+                const auto row = cellIdx(i, j, k);
+                int numNeighbors = 0;
+                auto couple = [&](int ii, int jj, int kk) {
+                    if (ii < 0 || jj < 0 || kk < 0 || ii >= nx || jj >= ny || kk >= nz) {
+                        return;
+                    }
+                    A.entry(row, cellIdx(ii, jj, kk)) = offDiag;
+                    ++numNeighbors;
+                };
+                couple(i - 1, j, k); couple(i + 1, j, k);
+                couple(i, j - 1, k); couple(i, j + 1, k);
+                couple(i, j, k - 1); couple(i, j, k + 1);
+
+                auto& diag = A.entry(row, row);
+                diag = 0.0;
+                for (int eq = 0; eq < blockSize; ++eq) {
+                    diag[eq][eq] = numNeighbors + 1.0;
+                    diag[eq][0] = 0.1 * numNeighbors;
+                }
+                diag[0][0] = numNeighbors + 1.0;
+            }
+        }
+    }
+    A.compress();
+
+    return A;
+}
+
+void benchmarkPreconditioners(Harness& harness,
+                              const Matrix& matrix,
+                              const std::string& caseName)
+{
+    using Operator = Dune::MatrixAdapter<Matrix, Vector, Vector>;
+    using PrecFactory = Opm::PreconditionerFactory<Operator, Dune::Amg::SequentialInformation>;
+
+    const Operator op(matrix);
+    const Opm::FlowLinearSolverParameters params;
+
+    struct PrecConfig { std::string name; Opm::PropertyTree prm; };
+    const std::vector<PrecConfig> configs {
+        { "ilu0", Opm::setupILU("ilu0", params) },
+        { "dilu", Opm::setupDILU("dilu", params) },
+        { "cpr", Opm::setupCPR("cpr_quasiimpes", params) },
+    };
+
+    const std::function<Vector()> weights = [&matrix]()
+    {
+        return Opm::Amg::getQuasiImpesWeights<Matrix, Vector>(matrix, /*pressureVarIndex=*/0,
+                                                               /*transpose=*/false,
+                                                               /*enable_thread_parallel=*/false);
+    };
+
+    Vector rhs(matrix.N());
+    rhs = 1.0;
+    Vector x(matrix.N());
+
+    for (const auto& [name, prm] : configs) {
+        const auto& precPrm = prm.get_child("preconditioner");
+        harness.run("preconditioner_setup/" + name, caseName, matrix.N(), [&]()
+        {
+            auto prec = PrecFactory::create(op, precPrm, weights, /*pressureIndex=*/0);
+        });
+
+        auto prec = PrecFactory::create(op, precPrm, weights, /*pressureIndex=*/0);
+        harness.run("preconditioner_update/" + name, caseName, matrix.N(), [&]()
+        {
+            prec->update();
+        });
+        harness.run("preconditioner_apply/" + name, caseName, matrix.N(), [&]()
+        {
+            x = 0.0;
+            auto d = rhs;
+            prec->apply(x, d);
+        });
+    }
+}
+
+// ----------------- VFP interpolation -----------------
+
+std::vector<double> linspace(double lo, double hi, int n)
+{
+    std::vector<double> v(n);
+    for (int i = 0; i < n; ++i) {
+        v[i] = lo + (hi - lo) * i / (n - 1);
+    }
+    return v;
+}
+
+Opm::VFPProdTable syntheticVfpTable()
+{
+    const auto flo = linspace(1.0, 5000.0, 20);
+    const auto thp = linspace(10.0, 100.0, 10);
+    const auto wfr = linspace(0.0, 0.9, 8);
+    const auto gfr = linspace(50.0, 500.0, 8);
+    const auto alq = linspace(0.0, 1.0e5, 5);
+
+    std::vector<double> data(flo.size() * thp.size() * wfr.size() * gfr.size() * alq.size());
+    unsigned long randx = 42;
+    for (auto& value : data) {
+        value = 100.0 + 200.0 * static_cast<double>(randx % 1000) / 1000.0;
+        randx = randx * 1103515245 + 12345;
+    }
+
+    return Opm::VFPProdTable(1, 1000.0,
+                             Opm::VFPProdTable::FLO_TYPE::FLO_OIL,
+                             Opm::VFPProdTable::WFR_TYPE::WFR_WCT,
+                             Opm::VFPProdTable::GFR_TYPE::GFR_GOR,
+                             Opm::VFPProdTable::ALQ_TYPE::ALQ_GRAT,
+                             flo, thp, wfr, gfr, alq, data);
+}
+
+void benchmarkVfp(Harness& harness,
+                  const std::vector<std::reference_wrapper<const Opm::VFPProdTable>>& tables,
+                  const std::string& caseName)
+{
+    using VFPHelpers = Opm::VFPHelpers<double>;
+    constexpr int numQueries = 10000;
+
+    for (const auto& tableRef : tables) {
+        const auto& table = tableRef.get();
+
+        // Sample the whole table including some extrapolation on both sides.
+        auto sample = [](const std::vector<double>& axis, int q)
+        {
+            const double lo = axis.front();
+            const double hi = axis.back();
+            return lo - 0.05 * (hi - lo) + 1.1 * (hi - lo) * ((q * 7919) % numQueries) / numQueries;
+        };
+
+        double sink = 0.0;
+        harness.run("vfp_interpolate/table_" + std::to_string(table.getTableNum()),
+                    caseName, numQueries, [&]()
+        {
+            for (int q = 0; q < numQueries; ++q) {
+                const auto flo_i = VFPHelpers::findInterpData(sample(table.getFloAxis(), q), table.getFloAxis());
+                const auto thp_i = VFPHelpers::findInterpData(sample(table.getTHPAxis(), q), table.getTHPAxis());
+                const auto wfr_i = VFPHelpers::findInterpData(sample(table.getWFRAxis(), q), table.getWFRAxis());
+                const auto gfr_i = VFPHelpers::findInterpData(sample(table.getGFRAxis(), q), table.getGFRAxis());
+                const auto alq_i = VFPHelpers::findInterpData(sample(table.getALQAxis(), q), table.getALQAxis());
+                sink += VFPHelpers::interpolate(table, flo_i, thp_i, wfr_i, gfr_i, alq_i).value;
+            }
+        });
+
+        if (!(sink == sink)) {
+            std::cerr << "VFP interpolation produced NaN for table "
+                      << table.getTableNum() << '\n';
+        }
+    }
+}
+
+// ----------------- Simulator based kernels -----------------
+
+template <class TypeTag>
+std::unique_ptr<Opm::GetPropType<TypeTag, Opm::Properties::Simulator>>
+initSimulator(const std::string& deckFile, int threads)
+{
+    using Simulator = Opm::GetPropType<TypeTag, Opm::Properties::Simulator>;
+
+    const std::string deckArg = "--ecl-deck-file-name=" + deckFile;
+    const char* argv[] = { "opm-simulators-bench", deckArg.c_str() };
+
+    Opm::Parameters::reset();
+    Opm::registerAllParameters_<TypeTag>(false);
+    Opm::registerEclTimeSteppingParameters<double>();
+    Opm::BlackoilModelParameters<double>::registerParameters();
+    Opm::Parameters::Register<Opm::Parameters::EnableTerminalOutput>
+        ("Print high-level information about the simulation's progress to the terminal");
+    Opm::Parameters::SetDefault<Opm::Parameters::ThreadsPerProcess>(threads);
+    Opm::Parameters::endRegistration();
+    Opm::setupParameters_<TypeTag>(/*argc=*/sizeof(argv) / sizeof(argv[0]),
+                                   argv,
+                                   /*registerParams=*/false,
+                                   /*allowUnused=*/false,
+                                   /*handleHelp=*/true,
+                                   /*myRank=*/0);
+
+    Opm::FlowGenericVanguard::readDeck(deckFile);
+    return std::make_unique<Simulator>();
+}
+
+template <class TypeTag>
+void benchmarkDeck(Harness& harness,
+                   const std::string& deckFile,
+                   const std::string& caseName,
+                   const Options& options)
+{
+    using StdWell = Opm::StandardWell<TypeTag>;
+
+    auto simulator = initSimulator<TypeTag>(deckFile, options.threads);
+    auto& model = simulator->model();
+    auto& problem = simulator->problem();
+    const auto& schedule = simulator->vanguard().schedule();
+
+    const double dt = std::min(schedule.stepLength(0), 86400.0);
+    model.applyInitialSolution();
+    simulator->setEpisodeIndex(-1);
+    simulator->setEpisodeLength(0.0);
+    simulator->startNextEpisode(/*episodeStartTime=*/0.0, schedule.stepLength(0));
+    simulator->setTimeStepSize(dt);
+    problem.beginEpisode();
+    problem.beginTimeStep();
+    problem.beginIteration();
+
+    const std::size_t numCells = model.numGridDof();
+
+    harness.run("update_cached_intensive_quantities", caseName, numCells, [&]()
+    {
+        model.invalidateAndUpdateIntensiveQuantities(/*timeIdx=*/0);
+    });
+
+    harness.run("tpfa_linearize_domain", caseName, numCells, [&]()
+    {
+        model.linearizer().linearizeDomain();
+    });
+
+    auto& wellModel = problem.wellModel();
+    std::vector<StdWell*> stdWells;
+    for (const auto& well : wellModel) {
+        if (auto* stdWell = dynamic_cast<StdWell*>(well.get())) {
+            stdWells.push_back(stdWell);
+        }
+    }
+    if (!stdWells.empty()) {
+        auto loggerGuard = wellModel.groupStateHelper().pushLogger();
+        harness.run("standard_well_assembly", caseName, stdWells.size(), [&]()
+        {
+            for (auto* well : stdWells) {
+                well->assembleWellEq(*simulator, dt, wellModel.groupStateHelper(),
+                                     wellModel.wellState());
+            }
+        });
+    }
+
+    const Matrix& jacobian = model.linearizer().jacobian().istlMatrix();
+    benchmarkPreconditioners(harness, jacobian, caseName);
+
+    benchmarkVfp(harness, schedule[0].vfpprod(), caseName);
+}
+
+/// Write a three-phase case with one injector and one producer in
+/// opposite corners of a Cartesian box of the requested size.
+std::string writeSyntheticDeck(const std::array<int, 3>& dims)
+{
+    const auto [nx, ny, nz] = dims;
+    const long n = static_cast<long>(nx) * ny * nz;
+
+    std::ostringstream deck;
+    deck << "RUNSPEC\n"
+         << "DIMENS\n " << nx << ' ' << ny << ' ' << nz << " /\n"
+         << "OIL\nWATER\nGAS\nDISGAS\nMETRIC\n"
+         << "START\n 1 'JAN' 2020 /\n"
+         << "WELLDIMS\n 2 " << nz << " 1 2 /\n"
+         << "EQLDIMS\n 1 1* 25 1* 1 /\n"
+         << "TABDIMS\n 1 1 50 60 1 60 1 1 /\n"
+         << "GRID\n"
+         << "DX\n " << n << "*100 /\n"
+         << "DY\n " << n << "*100 /\n"
+         << "DZ\n " << n << "*10 /\n"
+         << "TOPS\n " << static_cast<long>(nx) * ny << "*2000 /\n"
+         << "PORO\n " << n << "*0.2 /\n"
+         << "PERMX\n " << n << "*200 /\n"
+         << "PERMY\n " << n << "*200 /\n"
+         << "PERMZ\n " << n << "*20 /\n"
+         << "PROPS\n"
+         << "SWOF\n 0.2 0 1 0\n 0.3 0.07 0.8 0\n 1.0 1 0 0 /\n"
+         << "SGOF\n 0 0 1 0\n 0.05 0 0.8 0\n 0.79 1 0 0 /\n"
+         << "DENSITY\n 800 1000 1 /\n"
+         << "PVTW\n 1 1.0 4.0E-5 0.5 0.0 /\n"
+         << "PVDG\n 1 1.0 0.01\n 100 0.1 0.015\n 300 0.033 0.02 /\n"
+         << "PVTO\n"
+         << " 1 50 1.2 1.0\n 150 1.15 1.1\n 300 1.10 1.2 /\n"
+         << " 10 150 1.25 0.9\n 250 1.20 1.0\n 350 1.15 1.1 /\n/\n"
+         << "ROCK\n 200 5.0E-5 /\n"
+         << "SOLUTION\n"
+         << "EQUIL\n 2000 200 " << 2000 + 10 * nz << " 0 2000 0 1* 0 0 /\n"
+         << "SCHEDULE\n"
+         << "WELSPECS\n"
+         << " 'PROD' 'G' " << nx << ' ' << ny << " 1* 'OIL' /\n"
+         << " 'INJ' 'G' 1 1 1* 'WATER' /\n/\n"
+         << "COMPDAT\n"
+         << " 'PROD' " << nx << ' ' << ny << " 1 " << nz << " 'OPEN' 1* 1* 0.2 /\n"
+         << " 'INJ' 1 1 1 " << nz << " 'OPEN' 1* 1* 0.2 /\n/\n"
+         << "WCONPROD\n 'PROD' 'OPEN' 'ORAT' 1000 4* 100 /\n/\n"
+         << "WCONINJE\n 'INJ' 'WATER' 'OPEN' 'RATE' 1000 1* 400 /\n/\n"
+         << "TSTEP\n 1 /\n"
+         << "END\n";
+
+    const auto path = std::filesystem::temp_directory_path()
+        / ("OPM_BENCH_" + std::to_string(nx) + "x" + std::to_string(ny)
+           + "x" + std::to_string(nz) + ".DATA");
+    std::ofstream(path) << deck.str();
+
+    return path.string();
+}
+
+Options parseOptions(int argc, char** argv)
+{
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        auto value = [&arg](std::string_view key) -> std::string
+        {
+            return std::string(arg.substr(key.size()));
+        };
+
+        if (arg.rfind("--repetitions=", 0) == 0) {
+            options.repetitions = std::stoi(value("--repetitions="));
+        }
+        else if (arg.rfind("--threads=", 0) == 0) {
+            options.threads = std::stoi(value("--threads="));
+        }
+        else if (arg.rfind("--output=", 0) == 0) {
+            options.output = value("--output=");
+        }
+        else if (arg.rfind("--cartesian-size=", 0) == 0) {
+            std::istringstream is(value("--cartesian-size="));
+            char sep1 = 0, sep2 = 0;
+            is >> options.cartesianSize[0] >> sep1
+               >> options.cartesianSize[1] >> sep2
+               >> options.cartesianSize[2];
+            if (!is || sep1 != ',' || sep2 != ',' ||
+                *std::min_element(options.cartesianSize.begin(), options.cartesianSize.end()) < 1)
+            {
+                throw std::invalid_argument("Invalid --cartesian-size, expected NX,NY,NZ");
+            }
+        }
+        else if (arg.rfind("--", 0) == 0) {
+            throw std::invalid_argument("Unknown option " + std::string(arg));
+        }
+        else {
+            options.decks.emplace_back(arg);
+        }
+    }
+
+    return options;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    using TypeTag = Opm::Properties::TTag::FlowBenchmarkProblem;
+
+    Opm::resetLocale();
+    Dune::MPIHelper::instance(argc, argv);
+    Opm::FlowGenericVanguard::setCommunication(std::make_unique<Opm::Parallel::Communication>());
+
+    try {
+        const auto options = parseOptions(argc, argv);
+        Harness harness(options.repetitions);
+
+        const auto& dims = options.cartesianSize;
+        const std::string synthetic = "synthetic_" + std::to_string(dims[0]) + "x"
+            + std::to_string(dims[1]) + "x" + std::to_string(dims[2]);
+
+        std::cerr << "Running kernels on " << synthetic << '\n';
+        benchmarkPreconditioners(harness, syntheticMatrix(dims), synthetic + "_laplace");
+        {
+            const auto table = syntheticVfpTable();
+            benchmarkVfp(harness, { std::cref(table) }, synthetic);
+        }
+        const auto syntheticDeck = writeSyntheticDeck(dims);
+        benchmarkDeck<TypeTag>(harness, syntheticDeck, synthetic, options);
+        std::filesystem::remove(syntheticDeck);
+
+        for (const auto& deck : options.decks) {
+            std::cerr << "Running kernels on " << deck << '\n';
+            benchmarkDeck<TypeTag>(harness, deck,
+                                   std::filesystem::path(deck).stem().string(),
+                                   options);
+        }
+
+        if (options.output.empty()) {
+            harness.writeJson(std::cout, options);
+        }
+        else {
+            std::ofstream os(options.output);
+            if (!os) {
+                throw std::runtime_error("Could not open " + options.output + " for writing");
+            }
+            harness.writeJson(os, options);
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "opm-simulators-bench: " << e.what() << '\n';
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -68,6 +68,9 @@ public:
     template<class RateVector>
     void addToSource(RateVector& /*rates*/, unsigned /*globalSpaceIdx*/,
                      unsigned /*timeIdx*/) const {}
+    template<class MatrixBlock>
+    void addReservoirSourceTerms(GlobalEqVector& /*residual*/,
+                                 const std::vector<MatrixBlock*>& /*diagMatAddress*/) const {}
     void endIteration()const{};
     void endTimeStep(){};
     void endEpisode(){};
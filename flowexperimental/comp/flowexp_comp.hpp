@@ -23,6 +23,10 @@
 #include <opm/material/fluidsystems/GenericOilGasWaterFluidSystem.hpp>
 
 #include <opm/models/discretization/common/baseauxiliarymodule.hh>
+#if FLOWEXP_COMP_TPFA
+#include <opm/models/discretization/common/tpfalinearizer.hh>
+#include <opm/models/ptflash/flashlocalresidualtpfa.hh>
+#endif
 #include <opm/models/ptflash/flashmodel.hh>
 
 #include <opm/simulators/flow/FlowProblemComp.hpp>
@@ -116,6 +120,24 @@ struct Problem<TypeTag, TTag::FlowExpCompProblem<NumComp, EnableWater>>
     using type = FlowProblemComp<TypeTag>;
 };
 
+#if FLOWEXP_COMP_TPFA
+// use the TPFA linearizer, which avoids the element contexts during assembly.
+// This is built as flowexp_comp_tpfa. Its fluxes use the transmissibilities
+// of the deck, while the element context assembly takes the harmonic mean of
+// the cell permeabilities, so the results only agree on regular grids.
+template<class TypeTag, int NumComp, bool EnableWater>
+struct Linearizer<TypeTag, TTag::FlowExpCompProblem<NumComp, EnableWater>>
+{
+    using type = TpfaLinearizer<TypeTag>;
+};
+
+template<class TypeTag, int NumComp, bool EnableWater>
+struct LocalResidual<TypeTag, TTag::FlowExpCompProblem<NumComp, EnableWater>>
+{
+    using type = FlashLocalResidualTPFA<TypeTag>;
+};
+#endif
+
 template<class TypeTag, int NumComp, bool EnableWater>
 struct AquiferModel<TypeTag, TTag::FlowExpCompProblem<NumComp, EnableWater>> {
     using type = EmptyModel<TypeTag>;
@@ -69,6 +69,8 @@ public:
 
     const std::vector<std::size_t>& cells() const { return well_cells_; }
 
+    const std::vector<RateVector>& connectionRates() const { return connectionRates_; }
+
     virtual void apply(BVector& r) const = 0;
 
     /// using the solution x to recover the solution xw for wells and applying
@@ -102,6 +102,10 @@ public:
     void endEpisode() {}
 
     void computeTotalRatesForDof(RateVector& /*rate*/, unsigned /*globalIdx*/) const;
+
+    // add source from wells to the reservoir matrix
+    void addReservoirSourceTerms(GlobalEqVector& residual,
+                                 const std::vector<typename SparseMatrixAdapter::MatrixBlock*>& diagMatAddress) const;
     //
     [[nodiscard]] data::Wells wellData() const;
 
@@ -0,0 +1,282 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \copydoc Opm::BlackOilIntensiveQuantitiesSoA
+ */
+#ifndef EWOMS_BLACK_OIL_INTENSIVE_QUANTITIES_SOA_HH
+#define EWOMS_BLACK_OIL_INTENSIVE_QUANTITIES_SOA_HH
+
+#include <opm/common/TimingMacros.hpp>
+
+#include <opm/input/eclipse/EclipseState/Grid/FaceDir.hpp>
+
+#include <opm/material/thermal/EnergyModuleType.hpp>
+
+#include <opm/models/blackoil/blackoilproperties.hh>
+#include <opm/models/utils/alignedallocator.hh>
+#include <opm/models/utils/propertysystem.hh>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \ingroup BlackOilModel
+ *
+ * \brief Structure-of-arrays copy of the intensive quantities read by the TPFA flux
+ *        kernel of the black-oil model.
+ *
+ * The flux loop of the TPFA linearizer visits every cell once per neighbor, but
+ * only reads a few fields of each BlackOilIntensiveQuantities object. This class
+ * keeps those fields (phase pressures, densities, inverse formation volume factors,
+ * mobilities, dissolution factors, the rock compaction transmissibility multiplier
+ * and the PVT region) in contiguous, cache-line aligned arrays, one array per field.
+ * The cell() views provide the subset of the intensive quantities interface that
+ * BlackOilLocalResidualTPFA::computeFlux() uses.
+ *
+ * The layout is only valid for models without the energy, brine, bioeffects,
+ * diffusion, dispersion and extended black-oil modules (see isSupported), and only
+ * for runs without directional relative permeabilities and with convective mixing
+ * inactive (see isApplicable()).
+ */
+template <class TypeTag>
+class BlackOilIntensiveQuantitiesSoA
+{
+    using Evaluation = GetPropType<TypeTag, Properties::Evaluation>;
+    using FluidSystem = GetPropType<TypeTag, Properties::FluidSystem>;
+    using IntensiveQuantities = GetPropType<TypeTag, Properties::IntensiveQuantities>;
+    using FluidState = typename IntensiveQuantities::FluidState;
+    using PvtRegionIndex = std::remove_cvref_t<decltype(std::declval<FluidState>().pvtRegionIndex())>;
+
+    enum { numPhases = getPropValue<TypeTag, Properties::NumPhases>() };
+
+    static constexpr bool enableConvectiveMixing =
+        getPropValue<TypeTag, Properties::EnableConvectiveMixing>();
+
+    template <class T>
+    using AlignedVector = std::vector<T, aligned_allocator<T, 64>>;
+
+public:
+    static constexpr bool isSupported =
+        getPropValue<TypeTag, Properties::EnergyModuleType>() != EnergyModules::FullyImplicitThermal &&
+        !getPropValue<TypeTag, Properties::EnableBrine>() &&
+        !getPropValue<TypeTag, Properties::EnableSaltPrecipitation>() &&
+        !getPropValue<TypeTag, Properties::EnableBioeffects>() &&
+        !getPropValue<TypeTag, Properties::EnableDiffusion>() &&
+        !getPropValue<TypeTag, Properties::EnableDispersion>() &&
+        !getPropValue<TypeTag, Properties::EnableExtbo>() &&
+        std::is_empty_v<FluidSystem>;
+
+    /*!
+     * \brief The fluid state part of a cell view.
+     */
+    class FluidStateView
+    {
+    public:
+        FluidStateView(const BlackOilIntensiveQuantitiesSoA& soa, unsigned cellIdx)
+            : soa_(&soa), cellIdx_(cellIdx)
+        {}
+
+        const Evaluation& pressure(unsigned phaseIdx) const
+        { return soa_->pressure_[phaseIdx][cellIdx_]; }
+
+        const Evaluation& density(unsigned phaseIdx) const
+        { return soa_->density_[phaseIdx][cellIdx_]; }
+
+        const Evaluation& invB(unsigned phaseIdx) const
+        { return soa_->invB_[phaseIdx][cellIdx_]; }
+
+        const Evaluation& Rs() const
+        { return soa_->Rs_[cellIdx_]; }
+
+        const Evaluation& Rv() const
+        { return soa_->Rv_[cellIdx_]; }
+
+        const Evaluation& Rsw() const
+        { return soa_->Rsw_[cellIdx_]; }
+
+        const Evaluation& Rvw() const
+        { return soa_->Rvw_[cellIdx_]; }
+
+        PvtRegionIndex pvtRegionIndex() const
+        { return soa_->pvtRegionIdx_[cellIdx_]; }
+
+        const FluidSystem& fluidSystem() const
+        { return soa_->fluidSystem_; }
+
+    private:
+        const BlackOilIntensiveQuantitiesSoA* soa_;
+        unsigned cellIdx_;
+    };
+
+    /*!
+     * \brief View of the intensive quantities of a single cell.
+     */
+    class CellView
+    {
+    public:
+        CellView(const BlackOilIntensiveQuantitiesSoA& soa, unsigned cellIdx)
+            : soa_(&soa), cellIdx_(cellIdx)
+        {}
+
+        FluidStateView fluidState() const
+        { return FluidStateView(*soa_, cellIdx_); }
+
+        const Evaluation& mobility(unsigned phaseIdx) const
+        { return soa_->mobility_[phaseIdx][cellIdx_]; }
+
+        // directional mobilities are excluded by isApplicable()
+        const Evaluation& mobility(unsigned phaseIdx, FaceDir::DirEnum) const
+        { return mobility(phaseIdx); }
+
+        const Evaluation& rockCompTransMultiplier() const
+        { return soa_->rockCompTransMult_[cellIdx_]; }
+
+        PvtRegionIndex pvtRegionIndex() const
+        { return soa_->pvtRegionIdx_[cellIdx_]; }
+
+        const FluidSystem& getFluidSystem() const
+        { return soa_->fluidSystem_; }
+
+    private:
+        const BlackOilIntensiveQuantitiesSoA* soa_;
+        unsigned cellIdx_;
+    };
+
+    /*!
+     * \brief Returns true if the run does not use any feature that the cell views
+     *        cannot represent.
+     */
+    template <class Problem>
+    static bool isApplicable(const Problem& problem)
+    {
+        if constexpr (!isSupported) {
+            return false;
+        }
+        else {
+            const auto& materialLawManager = problem.materialLawManager();
+            if (materialLawManager->hasDirectionalRelperms() ||
+                materialLawManager->hasDirectionalImbnum())
+            {
+                return false;
+            }
+
+            if constexpr (enableConvectiveMixing) {
+                for (const bool active : problem.moduleParams().convectiveMixingModuleParam.active_) {
+                    if (active) {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+    }
+
+    /*!
+     * \brief Copy the fields used by the flux kernel from the intensive quantities
+     *        cache of the model for time index 0.
+     */
+    template <class Model>
+    void update(const Model& model)
+    {
+        OPM_TIMEBLOCK(updateIntensiveQuantitiesSoA);
+        const std::size_t numCells = model.numTotalDof();
+        resize_(numCells);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+            const IntensiveQuantities& intQuants = model.intensiveQuantities(cellIdx, /*timeIdx=*/0);
+            const auto& fs = intQuants.fluidState();
+            for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+                if (!FluidSystem::phaseIsActive(phaseIdx)) {
+                    continue;
+                }
+                pressure_[phaseIdx][cellIdx] = fs.pressure(phaseIdx);
+                density_[phaseIdx][cellIdx] = fs.density(phaseIdx);
+                invB_[phaseIdx][cellIdx] = fs.invB(phaseIdx);
+                mobility_[phaseIdx][cellIdx] = intQuants.mobility(phaseIdx);
+            }
+            if (!Rs_.empty()) {
+                Rs_[cellIdx] = fs.Rs();
+            }
+            if (!Rv_.empty()) {
+                Rv_[cellIdx] = fs.Rv();
+            }
+            if (!Rsw_.empty()) {
+                Rsw_[cellIdx] = fs.Rsw();
+            }
+            if (!Rvw_.empty()) {
+                Rvw_[cellIdx] = fs.Rvw();
+            }
+            rockCompTransMult_[cellIdx] = intQuants.rockCompTransMultiplier();
+            pvtRegionIdx_[cellIdx] = intQuants.pvtRegionIndex();
+        }
+    }
+
+    CellView cell(unsigned cellIdx) const
+    { return CellView(*this, cellIdx); }
+
+private:
+    void resize_(std::size_t numCells)
+    {
+        for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+            const std::size_t size = FluidSystem::phaseIsActive(phaseIdx) ? numCells : 0;
+            pressure_[phaseIdx].resize(size);
+            density_[phaseIdx].resize(size);
+            invB_[phaseIdx].resize(size);
+            mobility_[phaseIdx].resize(size);
+        }
+        // the dissolution factors are only read if the fluid system enables them
+        Rs_.resize(FluidSystem::enableDissolvedGas() ? numCells : 0);
+        Rv_.resize(FluidSystem::enableVaporizedOil() ? numCells : 0);
+        Rsw_.resize(FluidSystem::enableDissolvedGasInWater() ? numCells : 0);
+        Rvw_.resize(FluidSystem::enableVaporizedWater() ? numCells : 0);
+        rockCompTransMult_.resize(numCells);
+        pvtRegionIdx_.resize(numCells);
+    }
+
+    std::array<AlignedVector<Evaluation>, numPhases> pressure_;
+    std::array<AlignedVector<Evaluation>, numPhases> density_;
+    std::array<AlignedVector<Evaluation>, numPhases> invB_;
+    std::array<AlignedVector<Evaluation>, numPhases> mobility_;
+    AlignedVector<Evaluation> Rs_;
+    AlignedVector<Evaluation> Rv_;
+    AlignedVector<Evaluation> Rsw_;
+    AlignedVector<Evaluation> Rvw_;
+    AlignedVector<Evaluation> rockCompTransMult_;
+    std::vector<PvtRegionIndex> pvtRegionIdx_;
+    FluidSystem fluidSystem_{};
+};
+
+} // namespace Opm
+
+#endif // EWOMS_BLACK_OIL_INTENSIVE_QUANTITIES_SOA_HH
@@ -43,18 +43,21 @@
 #include <opm/models/blackoil/blackoilenergymodules.hh>
 #include <opm/models/blackoil/blackoilextbomodules.hh>
 #include <opm/models/blackoil/blackoilfoammodules.hh>
+#include <opm/models/blackoil/blackoilintensivequantitiessoa.hh>
 #include <opm/models/blackoil/blackoilmoduleparams.hh>
 #include <opm/models/blackoil/blackoilpolymermodules.hh>
 #include <opm/models/blackoil/blackoilproperties.hh>
 #include <opm/models/blackoil/blackoilsolventmodules.hh>
 
 #include <opm/common/ErrorMacros.hpp>
+#include <opm/common/TimingMacros.hpp>
 #include <opm/common/utility/gpuDecorators.hpp>
 
 #include <array>
 #include <cassert>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 
 #include <opm/common/utility/gpuistl_if_available.hpp>
 
@@ -138,6 +141,9 @@ class BlackOilLocalResidualTPFA : public GetPropType<TypeTag, Properties::DiscLo
     using Toolbox = MathToolbox<Evaluation>;
 
 public:
+    //! Structure-of-arrays layout of the intensive quantities read by computeFlux()
+    using IntensiveQuantitiesSoA = BlackOilIntensiveQuantitiesSoA<TypeTag>;
+
     struct ResidualNBInfo {
         double trans;
         double faceArea;
@@ -405,7 +411,8 @@ public:
                                                              thpres,
                                                              moduleParams);
 
-            const IntensiveQuantities& up = (upIdx == interiorDofIdx) ? intQuantsIn : intQuantsEx;
+            const IntensiveQuantitiesT& up = (upIdx == interiorDofIdx) ? intQuantsIn : intQuantsEx;
+            using UpFluidState = std::remove_cvref_t<decltype(up.fluidState())>;
             unsigned globalUpIndex = (upIdx == interiorDofIdx) ? globalIndexIn : globalIndexEx;
             // Use arithmetic average (more accurate with harmonic, but that requires recomputing
             // the transmissbility)
@@ -435,7 +442,7 @@ public:
             unsigned pvtRegionIdx = up.pvtRegionIndex();
             // if (upIdx == globalFocusDofIdx){
             if (globalUpIndex == globalIndexIn) {
-                const auto& invB = getInvB_<FluidSystem, FluidState, Evaluation>(
+                const auto& invB = getInvB_<FluidSystem, UpFluidState, Evaluation>(
                     up.fluidState(), phaseIdx, pvtRegionIdx, fsys);
                 const auto& surfaceVolumeFlux = invB * darcyFlux;
 
@@ -454,7 +461,7 @@ public:
                         flux, phaseIdx, darcyFlux, up.fluidState());
                 }
             } else {
-                const auto& invB = getInvB_<FluidSystem, FluidState, Scalar>(
+                const auto& invB = getInvB_<FluidSystem, UpFluidState, Scalar>(
                     up.fluidState(), phaseIdx, pvtRegionIdx, fsys);
                 const auto& surfaceVolumeFlux = invB * darcyFlux;
                 evalPhaseFluxes_<Scalar>(
@@ -492,8 +499,10 @@ public:
             "Relevant computeFlux() method must be implemented for this module before enabling.");
         // PolymerModule::computeFlux(flux, elemCtx, scvfIdx, timeIdx);
 
-        // deal with convective mixing
-        if constexpr (enableConvectiveMixing) {
+        // deal with convective mixing. Views of the intensive quantities (see
+        // IntensiveQuantitiesSoA) are only used if convective mixing is inactive.
+        if constexpr (enableConvectiveMixing &&
+                      std::is_convertible_v<const IntensiveQuantitiesT&, const IntensiveQuantities&>) {
             ConvectiveMixingModule::addConvectiveMixingFlux(
                 flux,
                 intQuantsIn,
@@ -87,7 +87,7 @@ public:
     {
         ParentType::finishInit();
 
-        wasSwitched_.resize(this->model().numTotalDof(), false);
+        wasSwitched_.resize(this->model().numTotalDof(), 0);
     }
 
     /*!
@@ -435,6 +435,10 @@ protected:
         }
 
         if (wasSwitched_[globalDofIdx]) {
+            // subdomains may be updated concurrently
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
             ++numPriVarsSwitched_;
         }
         if (bparams_.projectSaturations_) {
@@ -450,8 +454,10 @@ private:
     BlackoilNewtonParams<Scalar> bparams_{};
 
     // keep track of cells where the primary variable meaning has changed
-    // to detect and hinder oscillations
-    std::vector<bool> wasSwitched_{};
+    // to detect and hinder oscillations. While these are logically bools,
+    // concurrent writes to vector<bool> are not thread safe, and cells of
+    // different subdomains may be updated concurrently.
+    std::vector<unsigned char> wasSwitched_{};
 };
 
 } // namespace Opm
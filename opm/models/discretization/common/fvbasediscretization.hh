@@ -721,6 +721,42 @@ public:
         }
     }
 
+    /*!
+     * \brief Invalidate the cached intensive quantities of all entities for which a
+     *        predicate holds.
+     *
+     * This allows to only update the intensive quantities of the degrees of freedom
+     * whose primary variables have changed.
+     *
+     * \param timeIdx The index used by the time discretization.
+     * \param isStale Called with the global space index of every valid cache entry.
+     *                The entry is invalidated if it returns true.
+     *
+     * \return The number of invalidated entries.
+     */
+    template <class Predicate>
+    std::size_t invalidateIntensiveQuantitiesCache(unsigned timeIdx, const Predicate& isStale) const
+    {
+        if (timeIdx >= cachedIntensiveQuantityHistorySize_ || !storeIntensiveQuantities()) {
+            return 0;
+        }
+
+        auto& upToDate = intensiveQuantityCacheUpToDate_[timeIdx];
+        const std::size_t numDof = upToDate.size();
+        std::size_t numInvalidated = 0;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:numInvalidated)
+#endif
+        for (std::size_t globalIdx = 0; globalIdx < numDof; ++globalIdx) {
+            if (upToDate[globalIdx] && isStale(globalIdx)) {
+                upToDate[globalIdx] = 0;
+                ++numInvalidated;
+            }
+        }
+
+        return numInvalidated;
+    }
+
     void invalidateAndUpdateIntensiveQuantities(unsigned timeIdx) const
     {
         invalidateIntensiveQuantitiesCache(timeIdx);
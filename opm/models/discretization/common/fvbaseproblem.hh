@@ -822,7 +822,10 @@ public:
      * \brief Returns the iteration context for iteration-dependent decisions.
      */
     const NewtonIterationContext& iterationContext() const
-    { return iterationContext_; }
+    {
+        const auto* threadContext = threadIterationContext();
+        return threadContext ? *threadContext : iterationContext_;
+    }
 
     /*!
      * \brief Reset the iteration context for a new timestep.
@@ -851,7 +854,23 @@ private:
      * \brief Mutable access to the iteration context for LocalContextGuard.
      */
     NewtonIterationContext& mutableIterationContext()
-    { return iterationContext_; }
+    {
+        auto* threadContext = threadIterationContext();
+        return threadContext ? *threadContext : iterationContext_;
+    }
+
+    /*!
+     * \brief Iteration context of the calling thread, if any.
+     *
+     * Set by LocalContextGuard for domain-local solves that run
+     * concurrently with other domain-local solves. It overrides the
+     * shared context for the owning thread only.
+     */
+    static NewtonIterationContext*& threadIterationContext()
+    {
+        static thread_local NewtonIterationContext* context = nullptr;
+        return context;
+    }
 
 public:
 
@@ -49,6 +49,7 @@
 #include <opm/models/discretization/common/linearizationtype.hh>
 #include <opm/simulators/linalg/exportSystem.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <exception>   // current_exception, rethrow_exception
@@ -58,7 +59,9 @@
 #include <numeric>
 #include <set>
 #include <stdexcept>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -81,6 +84,7 @@
 namespace Opm::Parameters {
 
 struct SeparateSparseSourceTerms { static constexpr bool value = false; };
+struct SoaFluxCache { static constexpr bool value = false; };
 
 } // namespace Opm::Parameters
 
@@ -175,6 +179,23 @@ namespace  gpuistl {
 }
 #endif
 
+//! Placeholder for local residuals without a structure-of-arrays flux cache.
+struct NoIntensiveQuantitiesSoA
+{
+    static constexpr bool isSupported = false;
+};
+
+//! The structure-of-arrays layout of the intensive quantities read by the
+//! flux kernel of a local residual, if it provides one.
+template <class LocalResidual, class = void>
+struct IntensiveQuantitiesSoAOf
+{ using type = NoIntensiveQuantitiesSoA; };
+
+template <class LocalResidual>
+struct IntensiveQuantitiesSoAOf<LocalResidual,
+                                std::void_t<typename LocalResidual::IntensiveQuantitiesSoA>>
+{ using type = typename LocalResidual::IntensiveQuantitiesSoA; };
+
 /*!
  * \ingroup FiniteVolumeDiscretizations
  *
@@ -203,6 +224,7 @@ class TpfaLinearizer
     using Stencil = GetPropType<TypeTag, Properties::Stencil>;
     using LocalResidual = GetPropType<TypeTag, Properties::LocalResidual>;
     using IntensiveQuantities = GetPropType<TypeTag, Properties::IntensiveQuantities>;
+    using IntensiveQuantitiesSoA = typename IntensiveQuantitiesSoAOf<LocalResidual>::type;
     using Indices = GetPropType<TypeTag, Properties::Indices>;
 
     using Element = typename GridView::template Codim<0>::Entity;
@@ -239,6 +261,7 @@ public:
     {
         simulatorPtr_ = nullptr;
         separateSparseSourceTerms_ = Parameters::Get<Parameters::SeparateSparseSourceTerms>();
+        soaFluxCache_ = Parameters::Get<Parameters::SoaFluxCache>();
         exportIndex_=-1;
         exportCount_=-1;
     }
@@ -249,7 +272,11 @@ public:
     static void registerParameters()
     {
         Parameters::Register<Parameters::SeparateSparseSourceTerms>
-            ("Treat well source terms all in one go, instead of on a cell by cell basis.");
+            ("Treat well and aquifer source terms all in one go, instead of on a cell by cell basis.");
+        Parameters::Register<Parameters::SoaFluxCache>
+            ("Copy the intensive quantities read by the flux kernel into contiguous "
+             "per-field arrays before full-domain linearizations. Only used for models "
+             "and runs which support it.");
     }
 
     /*!
@@ -365,6 +392,56 @@ public:
         linearize_(domain);
     }
 
+    /*!
+     * \brief Returns true if disjoint subdomains may be linearized concurrently,
+     *        after calling freezeSubdomainNeighbors().
+     *
+     * This is not the case with separate sparse source terms, since those are
+     * added for all cells whenever a subdomain is linearized.
+     */
+    bool canLinearizeSubdomainsConcurrently() const
+    { return !separateSparseSourceTerms_; }
+
+    /*!
+     * \brief Take copies of the intensive quantities of all cells which neighbour,
+     *        but are not part of, one of the given subdomains.
+     *
+     * Until releaseSubdomainNeighbors() is called, linearizing one of the subdomains
+     * uses these copies instead of the live intensive quantities of its neighbours,
+     * and does not touch the Jacobian rows of cells outside the subdomain. This
+     * allows the subdomains to be linearized concurrently while their solutions are
+     * updated.
+     */
+    template <class SubDomainType>
+    void freezeSubdomainNeighbors(const std::vector<SubDomainType>& domains)
+    {
+        if (!jacobian_) {
+            initFirstIteration_();
+        }
+        frozenIndex_.assign(model_().numTotalDof(), -1);
+        frozenIntQuants_.clear();
+        for (const auto& domain : domains) {
+            for (const int globI : domain.cells) {
+                for (const auto& nbInfo : neighborInfo_[globI]) {
+                    const unsigned globJ = nbInfo.neighbor;
+                    if (!isInDomain_(domain, globJ) && frozenIndex_[globJ] < 0) {
+                        frozenIndex_[globJ] = frozenIntQuants_.size();
+                        frozenIntQuants_.push_back(model_().intensiveQuantities(globJ, /*timeIdx*/ 0));
+                    }
+                }
+            }
+        }
+    }
+
+    /*!
+     * \brief Go back to using the live intensive quantities of subdomain neighbours.
+     */
+    void releaseSubdomainNeighbors()
+    {
+        frozenIndex_.clear();
+        frozenIntQuants_.clear();
+    }
+
     void finalize()
     { jacobian_->finalize(); }
 
@@ -917,6 +994,31 @@ private:
         const auto& blockVelocity = simulator_().problem().eclWriter().outputModule().getFlows().blockVelocity();
         const unsigned int numCells = domain.cells.size();
 
+        bool neighborsFrozen = false;
+        bool useSoA = false;
+        if constexpr (std::is_same_v<SubDomainType, FullDomain<>>) {
+            if constexpr (IntensiveQuantitiesSoA::isSupported) {
+                useSoA = soaFluxCache_ && IntensiveQuantitiesSoA::isApplicable(problem_());
+                if (useSoA) {
+                    intQuantsSoA_.update(model_());
+                }
+            }
+        }
+        else {
+            neighborsFrozen = !frozenIndex_.empty();
+        }
+
+        // Whether the velocity of the faces of a cell should be stored.
+        const auto storeVelocity = [&](const unsigned globI)
+        {
+            if (dispersionActive || enableBioeffects) {
+                return true;
+            }
+            return !blockVelocity.empty() &&
+                std::ranges::binary_search(blockVelocity,
+                                           simulator_().vanguard().cartesianIndex(globI));
+        };
+
         // Fetch timestepsize used later in accumulation term.
         const double dt = simulator_().timeStepSize();
 
@@ -930,47 +1032,29 @@ private:
             VectorBlock res(0.0);
             MatrixBlock bMat(0.0);
             ADVectorBlock adres(0.0);
-            ADVectorBlock darcyFlux(0.0);
             const IntensiveQuantities& intQuantsIn = model_().intensiveQuantities(globI, /*timeIdx*/ 0);
 
             // Flux term.
             {
                 OPM_TIMEBLOCK_LOCAL(fluxCalculationForEachCell, Subsystem::Assembly);
-                short loc = 0;
+                unsigned loc = 0;
                 for (const auto& nbInfo : nbInfos) {
-                    OPM_TIMEBLOCK_LOCAL(fluxCalculationForEachFace, Subsystem::Assembly);
                     const unsigned globJ = nbInfo.neighbor;
-                    assert(globJ != globI);
-                    res = 0.0;
-                    bMat = 0.0;
-                    adres = 0.0;
-                    darcyFlux = 0.0;
-                    const IntensiveQuantities& intQuantsEx = model_().intensiveQuantities(globJ, /*timeIdx*/ 0);
-                    LocalResidual::computeFlux(adres, darcyFlux, globI, globJ, intQuantsIn, intQuantsEx,
-                                               nbInfo.res_nbinfo, problem_().moduleParams());
-                    adres *= nbInfo.res_nbinfo.faceArea;
-                    if (dispersionActive || enableBioeffects) {
-                        for (unsigned phaseIdx = 0; phaseIdx < numEq; ++phaseIdx) {
-                            velocityInfo_[globI][loc].velocity[phaseIdx] =
-                                darcyFlux[phaseIdx].value() / nbInfo.res_nbinfo.faceArea;
-                        }
+                    if (neighborsFrozen && !isInDomain_(domain, globJ)) {
+                        // Row globJ belongs to another subdomain, possibly being
+                        // linearized at the same time, and is not needed here.
+                        assembleHalfFace_(globI, loc, nbInfo, intQuantsIn,
+                                          frozenIntQuants_[frozenIndex_[globJ]],
+                                          storeVelocity, /*couplingBlock=*/false);
                     }
-                    else if (!blockVelocity.empty()) {
-                        if (std::ranges::binary_search(blockVelocity,
-                                                       simulator_().vanguard().cartesianIndex(globI))) {
-                            for (unsigned phaseIdx = 0; phaseIdx < numEq; ++phaseIdx) {
-                                velocityInfo_[globI][loc].velocity[phaseIdx] =
-                                    darcyFlux[phaseIdx].value() / nbInfo.res_nbinfo.faceArea;
-                            }
-                        }
+                    else {
+                        withFluxIntensiveQuantities_(useSoA, globI, globJ,
+                            [&](const auto& intQuantsI, const auto& intQuantsJ)
+                            {
+                                assembleHalfFace_(globI, loc, nbInfo, intQuantsI, intQuantsJ,
+                                                  storeVelocity);
+                            });
                     }
-                    setResAndJacobi(res, bMat, adres);
-                    residual_[globI] += res;
-                    //SparseAdapter syntax:  jacobian_->addToBlock(globI, globI, bMat);
-                    *diagMatAddress_[globI] += bMat;
-                    bMat *= -1.0;
-                    //SparseAdapter syntax: jacobian_->addToBlock(globJ, globI, bMat);
-                    *nbInfo.matBlockAddress += bMat;
                     ++loc;
                 }
             }
@@ -1027,7 +1111,7 @@ private:
             *diagMatAddress_[globI] += bMat;
 
             // Cell-wise source terms.
-            // This will include well sources if SeparateSparseSourceTerms is false.
+            // This will include well and aquifer sources if SeparateSparseSourceTerms is false.
             res = 0.0;
             bMat = 0.0;
             adres = 0.0;
@@ -1044,9 +1128,10 @@ private:
             *diagMatAddress_[globI] += bMat;
         } // end of loop for cell globI.
 
-        // Add sparse source terms. For now only wells.
+        // Add sparse source terms of wells and aquifers.
         if (separateSparseSourceTerms_) {
             problem_().wellModel().addReservoirSourceTerms(residual_, diagMatAddress_);
+            problem_().aquiferModel().addReservoirSourceTerms(residual_, diagMatAddress_);
         }
 
         // Boundary terms. Only looping over cells with nontrivial bcs.
@@ -1069,6 +1154,70 @@ private:
         }
     }
 
+    // Call fn with the intensive quantities of cells globI and globJ, either as
+    // views into the structure-of-arrays cache or as the cached objects of the model.
+    template <class Fn>
+    void withFluxIntensiveQuantities_(const bool useSoA,
+                                      const unsigned globI,
+                                      const unsigned globJ,
+                                      const Fn& fn) const
+    {
+        if constexpr (IntensiveQuantitiesSoA::isSupported) {
+            if (useSoA) {
+                fn(intQuantsSoA_.cell(globI), intQuantsSoA_.cell(globJ));
+                return;
+            }
+        }
+        fn(model_().intensiveQuantities(globI, /*timeIdx*/ 0),
+           model_().intensiveQuantities(globJ, /*timeIdx*/ 0));
+    }
+
+    template <class SubDomainType>
+    static bool isInDomain_(const SubDomainType& domain, const unsigned globI)
+    {
+        return globI < domain.interior.size() && domain.interior[globI];
+    }
+
+    // Add the flux through one side of an interior face to the residual of
+    // cell globI, and its derivatives with respect to the primary variables
+    // of globI to the diagonal block of globI and, unless couplingBlock is
+    // false, to the block coupling the neighbour to globI.
+    template <class IntQuants, class StoreVelocity>
+    void assembleHalfFace_(const unsigned globI,
+                           const unsigned loc,
+                           const NeighborInfoCPU& nbInfo,
+                           const IntQuants& intQuantsIn,
+                           const IntQuants& intQuantsEx,
+                           const StoreVelocity& storeVelocity,
+                           const bool couplingBlock = true)
+    {
+        OPM_TIMEBLOCK_LOCAL(fluxCalculationForEachFace, Subsystem::Assembly);
+        const unsigned globJ = nbInfo.neighbor;
+        assert(globJ != globI);
+        VectorBlock res(0.0);
+        MatrixBlock bMat(0.0);
+        ADVectorBlock adres(0.0);
+        ADVectorBlock darcyFlux(0.0);
+        LocalResidual::computeFlux(adres, darcyFlux, globI, globJ, intQuantsIn, intQuantsEx,
+                                   nbInfo.res_nbinfo, problem_().moduleParams());
+        adres *= nbInfo.res_nbinfo.faceArea;
+        if (storeVelocity(globI)) {
+            for (unsigned phaseIdx = 0; phaseIdx < numEq; ++phaseIdx) {
+                velocityInfo_[globI][loc].velocity[phaseIdx] =
+                    darcyFlux[phaseIdx].value() / nbInfo.res_nbinfo.faceArea;
+            }
+        }
+        setResAndJacobi(res, bMat, adres);
+        residual_[globI] += res;
+        //SparseAdapter syntax:  jacobian_->addToBlock(globI, globI, bMat);
+        *diagMatAddress_[globI] += bMat;
+        if (couplingBlock) {
+            bMat *= -1.0;
+            //SparseAdapter syntax: jacobian_->addToBlock(globJ, globI, bMat);
+            *nbInfo.matBlockAddress += bMat;
+        }
+    }
+
     void updateStoredTransmissibilities()
     {
         if (neighborInfo_.empty()) {
@@ -1079,6 +1228,25 @@ private:
         }
 
         const unsigned numCells = model_().numTotalDof();
+        // Problems with compact transmissibility storage let them be refreshed by
+        // position instead of a search per cell pair.
+        if constexpr (requires(const Problem& problem) { problem.transmissibilityLayoutVersion(); }) {
+            updateTransmissibilityIndex_();
+            if (!transIndex_.empty()) {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+                for (unsigned globI = 0; globI < numCells; globI++) {
+                    auto nbInfos = neighborInfo_[globI];
+                    const auto transIdx = transIndex_[globI];
+                    for (std::size_t loc = 0; loc < nbInfos.size(); ++loc) {
+                        nbInfos[loc].res_nbinfo.trans = problem_().transmissibilityAt(transIdx[loc]);
+                    }
+                }
+                return;
+            }
+        }
+
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
@@ -1091,6 +1259,35 @@ private:
         }
     }
 
+    // Look up the positions of the transmissibilities of all neighbours in the
+    // storage of the problem again if they have been invalidated. The table is
+    // left empty if the problem cannot provide a position for every neighbour.
+    void updateTransmissibilityIndex_()
+    {
+        const std::size_t version = problem_().transmissibilityLayoutVersion();
+        if (version == transIndexVersion_) {
+            return;
+        }
+        transIndexVersion_ = version;
+        transIndex_ = SparseTable<std::ptrdiff_t>{};
+
+        const unsigned numCells = model_().numTotalDof();
+        SparseTable<std::ptrdiff_t> transIndex;
+        std::vector<std::ptrdiff_t> row;
+        for (unsigned globI = 0; globI < numCells; globI++) {
+            row.clear();
+            for (const auto& nbInfo : neighborInfo_[globI]) {
+                const auto idx = problem_().transmissibilityIndex(globI, nbInfo.neighbor);
+                if (idx < 0) {
+                    return;
+                }
+                row.push_back(idx);
+            }
+            transIndex.appendRow(row.begin(), row.end());
+        }
+        transIndex_ = std::move(transIndex);
+    }
+
     Simulator* simulatorPtr_{};
 
     // the jacobian matrix
@@ -1107,6 +1304,11 @@ private:
     SparseTable<NeighborInfoCPU> neighborInfo_{};
     std::vector<MatrixBlock*> diagMatAddress_{};
 
+    // Positions of the transmissibilities of neighborInfo_ in the storage of the
+    // problem, valid while transIndexVersion_ matches the problem.
+    SparseTable<std::ptrdiff_t> transIndex_{};
+    std::size_t transIndexVersion_ = 0;
+
     struct FlowInfo
     {
         int faceId;
@@ -1146,8 +1348,18 @@ private:
 
     bool separateSparseSourceTerms_ = false;
 
+    // Structure-of-arrays copy of the intensive quantities for the flux
+    // kernel, refreshed at the start of full-domain linearizations.
+    IntensiveQuantitiesSoA intQuantsSoA_;
+    bool soaFluxCache_ = false;
+
     FullDomain<> fullDomain_;
 
+    // Copies of the intensive quantities of subdomain neighbours, see
+    // freezeSubdomainNeighbors(). frozenIndex_ maps a cell to its copy, or -1.
+    std::vector<int> frozenIndex_;
+    std::vector<IntensiveQuantities> frozenIntQuants_;
+
     int exportIndex_;
     int exportCount_;
 };
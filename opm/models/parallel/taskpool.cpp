@@ -0,0 +1,355 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+#include <config.h>
+#include <opm/models/parallel/taskpool.hpp>
+
+#include <opm/models/parallel/threadmanager.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+namespace Opm {
+
+thread_local TaskPool* TaskPool::taskPool_ = nullptr;
+thread_local int TaskPool::workerThreadIndex_ = -1;
+
+struct TaskPool::Task
+{
+    std::function<void()> fn;
+    TaskGroup* group;
+};
+
+/*!
+ * \brief Chase-Lev work-stealing deque.
+ *
+ * The owning worker pushes and pops at the bottom, all other threads steal
+ * from the top. The memory orderings follow Lê et al., "Correct and Efficient
+ * Work-Stealing for Weak Memory Models", PPoPP 2013. Buffers which were
+ * replaced by a larger one are kept alive until the deque is destroyed since
+ * concurrent thieves may still read from them.
+ */
+class TaskPool::WorkStealingDeque
+{
+    struct Buffer
+    {
+        explicit Buffer(std::int64_t cap)
+            : capacity(cap)
+            , slots(new std::atomic<Task*>[cap])
+        {}
+
+        Task* get(std::int64_t i) const
+        { return slots[i & (capacity - 1)].load(std::memory_order_relaxed); }
+
+        void put(std::int64_t i, Task* task)
+        { slots[i & (capacity - 1)].store(task, std::memory_order_relaxed); }
+
+        std::int64_t capacity;
+        std::unique_ptr<std::atomic<Task*>[]> slots;
+    };
+
+public:
+    WorkStealingDeque()
+    {
+        buffers_.push_back(std::make_unique<Buffer>(64));
+        buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+    }
+
+    //! Called by the owning worker only.
+    void push(Task* task)
+    {
+        const std::int64_t b = bottom_.load(std::memory_order_relaxed);
+        const std::int64_t t = top_.load(std::memory_order_acquire);
+        Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+        if (b - t > buffer->capacity - 1) {
+            buffer = grow_(buffer, b, t);
+        }
+        buffer->put(b, task);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+
+    //! Called by the owning worker only.
+    Task* pop()
+    {
+        const std::int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t t = top_.load(std::memory_order_relaxed);
+
+        Task* task = nullptr;
+        if (t <= b) {
+            task = buffer->get(b);
+            if (t == b) {
+                // last element, race against thieves
+                if (!top_.compare_exchange_strong(t, t + 1,
+                                                  std::memory_order_seq_cst,
+                                                  std::memory_order_relaxed)) {
+                    task = nullptr;
+                }
+                bottom_.store(b + 1, std::memory_order_relaxed);
+            }
+        }
+        else {
+            bottom_.store(b + 1, std::memory_order_relaxed);
+        }
+        return task;
+    }
+
+    //! May be called by any thread.
+    Task* steal()
+    {
+        std::int64_t t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::int64_t b = bottom_.load(std::memory_order_acquire);
+
+        if (t < b) {
+            Buffer* buffer = buffer_.load(std::memory_order_acquire);
+            Task* task = buffer->get(t);
+            if (top_.compare_exchange_strong(t, t + 1,
+                                             std::memory_order_seq_cst,
+                                             std::memory_order_relaxed)) {
+                return task;
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    Buffer* grow_(Buffer* old, std::int64_t b, std::int64_t t)
+    {
+        buffers_.push_back(std::make_unique<Buffer>(2 * old->capacity));
+        Buffer* buffer = buffers_.back().get();
+        for (std::int64_t i = t; i < b; ++i) {
+            buffer->put(i, old->get(i));
+        }
+        buffer_.store(buffer, std::memory_order_release);
+        return buffer;
+    }
+
+    alignas(64) std::atomic<std::int64_t> top_ = 0;
+    alignas(64) std::atomic<std::int64_t> bottom_ = 0;
+    std::atomic<Buffer*> buffer_ = nullptr;
+    std::vector<std::unique_ptr<Buffer>> buffers_;
+};
+
+TaskPool::TaskPool(unsigned numWorkers)
+{
+    deques_.resize(numWorkers);
+    for (auto& deque : deques_)
+        deque = std::make_unique<WorkStealingDeque>();
+
+    threads_.resize(numWorkers);
+    for (unsigned i = 0; i < numWorkers; ++i)
+        // create a worker thread
+        threads_[i] = std::make_unique<std::thread>(startWorkerThread_, this, i);
+}
+
+TaskPool::~TaskPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        stop_.store(true);
+    }
+    workAvailableCondition_.notify_all();
+
+    for (auto& thread : threads_)
+        thread->join();
+}
+
+int TaskPool::workerThreadIndex() const
+{
+    if (TaskPool::taskPool_ != this)
+        return -1;
+    return TaskPool::workerThreadIndex_;
+}
+
+unsigned TaskPool::defaultNumWorkers()
+{
+    const unsigned numHardwareThreads = std::thread::hardware_concurrency();
+    const unsigned numOmpThreads = std::max(ThreadManager::maxThreads(), 1u);
+    return numHardwareThreads > numOmpThreads ? numHardwareThreads - numOmpThreads : 1;
+}
+
+void TaskPool::spawn_(Task* task)
+{
+    const int self = workerThreadIndex();
+    if (self >= 0) {
+        deques_[self]->push(task);
+    }
+    else {
+        std::lock_guard<std::mutex> lock(injectionMutex_);
+        injectionQueue_.push_back(task);
+        injectionSize_.fetch_add(1, std::memory_order_release);
+    }
+
+    epoch_.fetch_add(1);
+    wakeWorker_();
+}
+
+void TaskPool::wakeWorker_()
+{
+    // the sequentially consistent accesses to epoch_ and numSleeping_ make sure
+    // that a worker going to sleep either sees the new epoch or gets notified
+    if (numSleeping_.load() > 0) {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        workAvailableCondition_.notify_one();
+    }
+}
+
+TaskPool::Task* TaskPool::findTask_()
+{
+    const int self = workerThreadIndex();
+    if (self >= 0) {
+        if (Task* task = deques_[self]->pop())
+            return task;
+    }
+
+    if (injectionSize_.load(std::memory_order_acquire) > 0) {
+        std::lock_guard<std::mutex> lock(injectionMutex_);
+        if (!injectionQueue_.empty()) {
+            Task* task = injectionQueue_.front();
+            injectionQueue_.pop_front();
+            injectionSize_.fetch_sub(1, std::memory_order_relaxed);
+            return task;
+        }
+    }
+
+    // try to steal from the other workers, starting with the next one
+    const int numDeques = deques_.size();
+    for (int i = 1; i <= numDeques; ++i) {
+        const int victim = (std::max(self, 0) + i) % numDeques;
+        if (victim == self)
+            continue;
+        if (Task* task = deques_[victim]->steal())
+            return task;
+    }
+
+    return nullptr;
+}
+
+void TaskPool::execute_(Task* task)
+{
+    std::exception_ptr error;
+    try {
+        task->fn();
+    }
+    catch (...) {
+        error = std::current_exception();
+    }
+
+    TaskGroup* group = task->group;
+    // release the captured state before the group is signalled
+    delete task;
+    group->finish_(error);
+}
+
+void TaskPool::startWorkerThread_(TaskPool* pool, int workerThreadIndex)
+{
+    TaskPool::taskPool_ = pool;
+    TaskPool::workerThreadIndex_ = workerThreadIndex;
+
+    pool->run_();
+}
+
+void TaskPool::run_()
+{
+    while (true) {
+        const std::size_t seenEpoch = epoch_.load();
+        if (Task* task = findTask_()) {
+            execute_(task);
+            continue;
+        }
+
+        // no work available: sleep until a new task is spawned or the pool is
+        // destroyed
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        numSleeping_.fetch_add(1);
+        workAvailableCondition_.wait(lock, [this, seenEpoch]
+                                     { return stop_.load() || epoch_.load() != seenEpoch; });
+        numSleeping_.fetch_sub(1);
+        if (stop_.load())
+            return;
+    }
+}
+
+TaskPool::TaskGroup::~TaskGroup()
+{
+    try {
+        wait();
+    }
+    catch (...) {
+        // exceptions must not escape the destructor
+    }
+}
+
+void TaskPool::TaskGroup::spawn_(std::function<void()> fn)
+{
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    auto* task = new Task{std::move(fn), this};
+    if (pool_.threads_.empty())
+        // run the task immediately in synchronous mode
+        pool_.execute_(task);
+    else
+        pool_.spawn_(task);
+}
+
+void TaskPool::TaskGroup::finish_(std::exception_ptr error)
+{
+    // the counter is decremented under the lock such that wait() cannot return
+    // (and the group cannot be destroyed) while the condition is being notified
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (error && !error_)
+        error_ = error;
+    if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        finishedCondition_.notify_all();
+}
+
+void TaskPool::TaskGroup::wait()
+{
+    while (pending_.load(std::memory_order_acquire) > 0) {
+        // help with pending work instead of blocking
+        if (Task* task = pool_.findTask_()) {
+            pool_.execute_(task);
+            continue;
+        }
+
+        // the remaining tasks of the group are running on other threads. The
+        // timeout makes sure that tasks which are spawned meanwhile are picked
+        // up by this thread as well.
+        std::unique_lock<std::mutex> lock(mutex_);
+        finishedCondition_.wait_for(lock, std::chrono::microseconds(100),
+                                    [this] { return pending_.load() == 0; });
+    }
+
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::swap(error, error_);
+    }
+    if (error)
+        std::rethrow_exception(error);
+}
+
+} // end namespace Opm
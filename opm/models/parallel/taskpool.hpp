@@ -0,0 +1,198 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \brief A fork/join task pool with work-stealing worker threads.
+ */
+#ifndef OPM_TASK_POOL_HPP
+#define OPM_TASK_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \brief A pool of persistent worker threads for coarse-grained tasks.
+ *
+ * In contrast to the TaskletRunner, which serves all tasklets from a single
+ * mutex-protected queue, every worker thread of the task pool owns a lock-free
+ * work-stealing deque (Chase-Lev). Tasks spawned by a worker are pushed to its
+ * own deque and idle workers steal from the other deques. Tasks spawned by
+ * threads which are not workers of the pool (e.g. the main thread or OpenMP
+ * threads) are put into a shared injection queue.
+ *
+ * Tasks are spawned into a TaskGroup and joined by TaskGroup::wait(). The
+ * joining thread runs pending tasks itself while waiting, so groups may be
+ * nested and waited upon from inside tasks. Idle workers sleep instead of
+ * spinning, which allows the pool to coexist with OpenMP loops without
+ * permanently occupying cores.
+ */
+class TaskPool
+{
+    struct Task;
+    class WorkStealingDeque;
+
+public:
+    class TaskGroup;
+
+    // prohibit copying of task pools
+    TaskPool(const TaskPool&) = delete;
+
+    /*!
+     * \brief Creates a task pool with numWorkers worker threads.
+     *
+     * The number of worker threads may be 0. In this case, all tasks are run by the
+     * spawning thread immediately (synchronous mode).
+     */
+    explicit TaskPool(unsigned numWorkers);
+
+    /*!
+     * \brief Destructor
+     *
+     * Terminates the worker threads. All task groups must have been waited upon
+     * before the pool is destroyed.
+     */
+    ~TaskPool();
+
+    /*!
+     * \brief Returns the number of worker threads of the task pool.
+     */
+    int numWorkerThreads() const
+    { return static_cast<int>(threads_.size()); }
+
+    /*!
+     * \brief Returns the index of the current worker thread.
+     *
+     * If the current thread is not a worker thread of this pool, -1 is returned.
+     */
+    int workerThreadIndex() const;
+
+    /*!
+     * \brief Returns a number of worker threads which does not oversubscribe the cores.
+     *
+     * This is the number of hardware threads which are not used by the OpenMP threads
+     * of the current process, but at least one.
+     */
+    static unsigned defaultNumWorkers();
+
+private:
+    friend class TaskGroup;
+
+    void spawn_(Task* task);
+    Task* findTask_();
+    void execute_(Task* task);
+    void wakeWorker_();
+
+    static void startWorkerThread_(TaskPool* pool, int workerThreadIndex);
+    void run_();
+
+    std::vector<std::unique_ptr<WorkStealingDeque>> deques_;
+    std::vector<std::unique_ptr<std::thread>> threads_;
+
+    // tasks spawned by threads which are not workers of this pool
+    std::deque<Task*> injectionQueue_;
+    std::mutex injectionMutex_;
+    std::atomic<std::size_t> injectionSize_ = 0;
+
+    // incremented for every spawned task, used to avoid lost wake-ups
+    std::atomic<std::size_t> epoch_ = 0;
+    std::atomic<int> numSleeping_ = 0;
+    std::atomic<bool> stop_ = false;
+    std::mutex sleepMutex_;
+    std::condition_variable workAvailableCondition_;
+
+    static thread_local TaskPool* taskPool_;
+    static thread_local int workerThreadIndex_;
+};
+
+/*!
+ * \brief A set of tasks which are joined together.
+ *
+ * \code
+ * TaskPool::TaskGroup group(pool);
+ * group.run([&]{ packOutput(); });
+ * group.run([&]{ computeWellPotentials(); });
+ * // ... do other work on the calling thread
+ * group.wait();
+ * \endcode
+ *
+ * If a task throws, the first exception is stored and rethrown by wait() after
+ * all tasks of the group have completed.
+ */
+class TaskPool::TaskGroup
+{
+public:
+    TaskGroup(const TaskGroup&) = delete;
+
+    explicit TaskGroup(TaskPool& pool)
+        : pool_(pool)
+    {}
+
+    /*!
+     * \brief Waits for the remaining tasks of the group. Exceptions are discarded.
+     */
+    ~TaskGroup();
+
+    /*!
+     * \brief Spawns a task which calls fn().
+     *
+     * The task is run on the calling thread immediately if the pool has no
+     * worker threads.
+     */
+    template <class Fn>
+    void run(Fn&& fn)
+    { spawn_(std::function<void()>(std::forward<Fn>(fn))); }
+
+    /*!
+     * \brief Waits until all tasks of the group have completed.
+     *
+     * The calling thread runs pending tasks of the pool while waiting. If any of
+     * the tasks of the group threw an exception, it is rethrown here.
+     */
+    void wait();
+
+private:
+    friend class TaskPool;
+
+    void spawn_(std::function<void()> fn);
+    void finish_(std::exception_ptr error);
+
+    TaskPool& pool_;
+    std::atomic<std::size_t> pending_ = 0;
+    std::exception_ptr error_;
+    std::mutex mutex_;
+    std::condition_variable finishedCondition_;
+};
+
+} // end namespace Opm
+
+#endif // OPM_TASK_POOL_HPP
@@ -44,11 +44,27 @@
 #include <opm/models/ptflash/flashparameters.hh>
 
 #include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
 #include <iostream>
 #include <string>
 
 namespace Opm {
 
+/*!
+ * \ingroup FlashModel
+ *
+ * \brief Counters of the cached phase state mode of the PT flash
+ *
+ * \sa Parameters::FlashCachePhaseState
+ */
+struct FlashCacheStatistics
+{
+    std::atomic<std::size_t> flashes{0}; //!< Number of flash calculations done
+    std::atomic<std::size_t> skipped{0}; //!< Number of flash calculations skipped
+};
+
 /*!
  * \ingroup FlashModel
  * \ingroup IntensiveQuantities
@@ -100,6 +116,14 @@ public:
     //! The type of the object returned by the fluidState() method
     using FluidState = CompositionalFluidState<Evaluation, FluidSystem, enableEnergy>;
 
+    //! The type of fluid states without derivatives, e.g. for boundary conditions
+    struct ScalarFluidState : public CompositionalFluidState<Scalar, FluidSystem, enableEnergy>
+    {
+        //! The compositional model does not distinguish PVT regions
+        unsigned pvtRegionIndex() const
+        { return 0; }
+    };
+
     FlashIntensiveQuantities() = default;
 
     FlashIntensiveQuantities(const FlashIntensiveQuantities& other) = default;
@@ -150,8 +174,12 @@ public:
             fluidState_.setPressure(phaseIdx, p);
         }
 
-        // Get initial K and L from storage initially (if enabled)
+        // Get initial K and L from storage initially (if enabled), falling
+        // back to the storage cache
         const auto* hint = elemCtx.thermodynamicHint(dofIdx, timeIdx);
+        if (!hint && timeIdx == 0) {
+            hint = elemCtx.thermodynamicHint(dofIdx, 1);
+        }
         if (hint) {
              for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
                  const Evaluation& Ktmp = hint->fluidState().K(compIdx);
@@ -160,16 +188,6 @@ public:
              const Evaluation& Ltmp = hint->fluidState().L();
              fluidState_.setLvalue(Ltmp);
         }
-        else if (timeIdx == 0 && elemCtx.thermodynamicHint(dofIdx, 1)) {
-             // checking the storage cache
-             const auto& hint2 = elemCtx.thermodynamicHint(dofIdx, 1);
-             for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
-                 const Evaluation& Ktmp = hint2->fluidState().K(compIdx);
-                 fluidState_.setKvalue(compIdx, Ktmp);
-             }
-             const Evaluation& Ltmp = hint2->fluidState().L();
-             fluidState_.setLvalue(Ltmp);
-        }
         else {
              for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
                  const Evaluation Ktmp = fluidState_.wilsonK_(compIdx);
@@ -187,7 +205,20 @@ public:
             std::cout << " updating the intensive quantities for Cell " << spatialIdx << std::endl;
         }
         const auto& eos_type = problem.getEosType();
-        FlashSolver::solve(fluidState_, flashTwoPhaseMethod, flashTolerance, eos_type, flashVerbosity);
+        const bool cachePhaseState = Parameters::Get<Parameters::FlashCachePhaseState>();
+        if (cachePhaseState && hint &&
+            hint->canReusePhaseState_(z, p, fluidState_.temperature(/*phaseIdx=*/0)))
+        {
+            reusePhaseState_(*hint, z);
+            ++cacheStatistics().skipped;
+        }
+        else {
+            FlashSolver::solve(fluidState_, flashTwoPhaseMethod, flashTolerance, eos_type, flashVerbosity);
+            if (cachePhaseState) {
+                storeFlashState_(z, p, fluidState_.temperature(/*phaseIdx=*/0));
+                ++cacheStatistics().flashes;
+            }
+        }
 
         if (flashVerbosity >= 5) {
             // printing of flash result after solve
@@ -333,12 +364,81 @@ public:
     const Evaluation& porosity() const
     { return porosity_; }
 
+    /*!
+     * \brief Returns the counters of the cached phase state mode
+     */
+    static FlashCacheStatistics& cacheStatistics()
+    {
+        static FlashCacheStatistics statistics;
+        return statistics;
+    }
+
 private:
+    // Returns true if the cell was single-phase in its last flash and its
+    // state has changed less than the cache tolerances since then.
+    bool canReusePhaseState_(const ComponentVector& z,
+                             const Evaluation& p,
+                             const Evaluation& T) const
+    {
+        if (!flashSinglePhase_) {
+            return false;
+        }
+
+        const Scalar zTol = Parameters::Get<Parameters::FlashCacheCompositionTolerance<Scalar>>();
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            if (std::abs(getValue(z[compIdx]) - flashZ_[compIdx]) > zTol) {
+                return false;
+            }
+        }
+
+        const Scalar relTol = Parameters::Get<Parameters::FlashCacheRelativeTolerance<Scalar>>();
+        return std::abs(getValue(p) - flashPressure_) <= relTol * std::abs(flashPressure_) &&
+               std::abs(getValue(T) - flashTemperature_) <= relTol * std::abs(flashTemperature_);
+    }
+
+    // Set up the single-phase state of the hint for the current composition.
+    // Both phases get the overall composition, as the flash does for
+    // single-phase cells. The reference state of the last flash is kept,
+    // so that small changes cannot accumulate over several reuses.
+    void reusePhaseState_(const FlashIntensiveQuantities& hint, const ComponentVector& z)
+    {
+        fluidState_.setLvalue(getValue(hint.fluidState().L()));
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            fluidState_.setMoleFraction(FluidSystem::oilPhaseIdx, compIdx, z[compIdx]);
+            fluidState_.setMoleFraction(FluidSystem::gasPhaseIdx, compIdx, z[compIdx]);
+        }
+
+        flashSinglePhase_ = true;
+        flashZ_ = hint.flashZ_;
+        flashPressure_ = hint.flashPressure_;
+        flashTemperature_ = hint.flashTemperature_;
+    }
+
+    // Remember the state of the flash just done.
+    void storeFlashState_(const ComponentVector& z,
+                          const Evaluation& p,
+                          const Evaluation& T)
+    {
+        const Scalar L = getValue(fluidState_.L());
+        flashSinglePhase_ = L <= 0.0 || L >= 1.0;
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            flashZ_[compIdx] = getValue(z[compIdx]);
+        }
+        flashPressure_ = getValue(p);
+        flashTemperature_ = getValue(T);
+    }
+
     DimMatrix intrinsicPerm_;
     FluidState fluidState_;
     Evaluation porosity_;
     std::array<Evaluation,numPhases> relativePermeability_;
     std::array<Evaluation,numPhases> mobility_;
+
+    // state of the last flash, used by the cached phase state mode
+    bool flashSinglePhase_{false};
+    std::array<Scalar,numComponents> flashZ_{};
+    Scalar flashPressure_{};
+    Scalar flashTemperature_{};
 };
 
 } // namespace Opm
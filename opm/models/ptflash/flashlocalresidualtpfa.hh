@@ -0,0 +1,335 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \copydoc Opm::FlashLocalResidualTPFA
+ */
+#ifndef OPM_PTFLASH_LOCAL_RESIDUAL_TPFA_HH
+#define OPM_PTFLASH_LOCAL_RESIDUAL_TPFA_HH
+
+#include <opm/input/eclipse/EclipseState/Grid/FaceDir.hpp>
+#include <opm/input/eclipse/Schedule/BCProp.hpp>
+
+#include <opm/material/common/ConditionalStorage.hpp>
+#include <opm/material/common/MathToolbox.hpp>
+#include <opm/material/thermal/EnergyModuleType.hpp>
+
+#include <opm/models/ptflash/flashlocalresidual.hh>
+
+#include <opm/common/TimingMacros.hpp>
+
+#include <cmath>
+#include <stdexcept>
+
+namespace Opm {
+
+/*!
+ * \ingroup FlashModel
+ *
+ * \brief Calculates the local residual of the PTFlash-based compositional
+ *        multi-phase model using two-point flux approximation.
+ *
+ * In addition to the element context based interface of FlashLocalResidual,
+ * this class provides the static storage, flux and source functions which
+ * are used by the TpfaLinearizer. The fluxes are computed directly from the
+ * intensive quantities of the two cells and the transmissibility of their
+ * common face.
+ */
+template <class TypeTag>
+class FlashLocalResidualTPFA : public FlashLocalResidual<TypeTag>
+{
+    using ParentType = FlashLocalResidual<TypeTag>;
+
+    using Scalar = GetPropType<TypeTag, Properties::Scalar>;
+    using Evaluation = GetPropType<TypeTag, Properties::Evaluation>;
+    using RateVector = GetPropType<TypeTag, Properties::RateVector>;
+    using Indices = GetPropType<TypeTag, Properties::Indices>;
+    using IntensiveQuantities = GetPropType<TypeTag, Properties::IntensiveQuantities>;
+    using FluidSystem = GetPropType<TypeTag, Properties::FluidSystem>;
+    using Problem = GetPropType<TypeTag, Properties::Problem>;
+
+    enum { numEq = getPropValue<TypeTag, Properties::NumEq>() };
+    enum { numPhases = getPropValue<TypeTag, Properties::NumPhases>() };
+    enum { numComponents = getPropValue<TypeTag, Properties::NumComponents>() };
+    enum { conti0EqIdx = Indices::conti0EqIdx };
+
+    enum { waterPhaseIdx = FluidSystem::waterPhaseIdx };
+
+    static constexpr bool waterEnabled = Indices::waterEnabled;
+    static constexpr bool enableEnergy = getPropValue<TypeTag, Properties::EnableEnergy>();
+    static constexpr bool enableFullyImplicitThermal
+        = (getPropValue<TypeTag, Properties::EnergyModuleType>()
+           == EnergyModules::FullyImplicitThermal);
+    static constexpr bool enableDiffusion = getPropValue<TypeTag, Properties::EnableDiffusion>();
+    static constexpr bool enableDispersion = getPropValue<TypeTag, Properties::EnableDispersion>();
+
+    static_assert(!enableEnergy && !enableFullyImplicitThermal,
+                  "Relevant computeFlux() method must be implemented for energy before enabling.");
+    static_assert(!enableDiffusion,
+                  "Relevant computeFlux() method must be implemented for diffusion before enabling.");
+
+    using Toolbox = MathToolbox<Evaluation>;
+
+public:
+    using ParentType::computeStorage;
+    using ParentType::computeFlux;
+    using ParentType::computeSource;
+
+    struct ResidualNBInfo {
+        double trans;
+        double faceArea;
+        double thpres;
+        double dZg;
+        FaceDir::DirEnum faceDir;
+        double Vin;
+        double Vex;
+        ConditionalStorage<enableFullyImplicitThermal, double> inAlpha;
+        ConditionalStorage<enableFullyImplicitThermal, double> outAlpha;
+        ConditionalStorage<enableDiffusion, double> diffusivity;
+        ConditionalStorage<enableDispersion, double> dispersivity;
+    };
+
+    /*!
+     * \brief Compute the storage term of a cell from its intensive quantities.
+     */
+    template <class LhsEval, class StorageType>
+    static void computeStorage(StorageType& storage,
+                               const IntensiveQuantities& intQuants)
+    {
+        OPM_TIMEBLOCK_LOCAL(computeStorage, Subsystem::Assembly);
+        const auto& fs = intQuants.fluidState();
+        const LhsEval porosity = Toolbox::template decay<LhsEval>(intQuants.porosity());
+        storage = 0.0;
+
+        for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+            const LhsEval phaseDensity =
+                Toolbox::template decay<LhsEval>(fs.density(phaseIdx)) *
+                Toolbox::template decay<LhsEval>(fs.saturation(phaseIdx)) *
+                porosity;
+
+            if (waterEnabled && phaseIdx == static_cast<unsigned int>(waterPhaseIdx)) {
+                storage[conti0EqIdx + numComponents] = phaseDensity;
+            }
+            else {
+                for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                    storage[conti0EqIdx + compIdx] +=
+                        Toolbox::template decay<LhsEval>(fs.massFraction(phaseIdx, compIdx)) *
+                        phaseDensity;
+                }
+            }
+        }
+    }
+
+    /*!
+     * \brief Compute the mass flux over the face between two cells.
+     *
+     * The flux is given per face area and counts outflow of the interior
+     * cell as positive. The derivatives are taken with respect to the
+     * primary variables of the interior cell only. \p darcy receives the
+     * volume fluxes of the phases, indexed by phase, as far as they fit
+     * into a rate vector.
+     */
+    template <class ModuleParamsT>
+    static void computeFlux(RateVector& flux,
+                            RateVector& darcy,
+                            const unsigned globalIndexIn,
+                            const unsigned globalIndexEx,
+                            const IntensiveQuantities& intQuantsIn,
+                            const IntensiveQuantities& intQuantsEx,
+                            const ResidualNBInfo& nbInfo,
+                            const ModuleParamsT& /* moduleParams */)
+    {
+        OPM_TIMEBLOCK_LOCAL(computeFlux, Subsystem::Assembly);
+        flux = 0.0;
+        darcy = 0.0;
+
+        const Scalar trans = nbInfo.trans;
+        const Scalar faceArea = nbInfo.faceArea;
+
+        for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+            Evaluation pressureDifference;
+            const bool upIsInterior = calculatePhasePressureDiff_(pressureDifference,
+                                                                  intQuantsIn,
+                                                                  intQuantsEx,
+                                                                  phaseIdx,
+                                                                  globalIndexIn,
+                                                                  globalIndexEx,
+                                                                  nbInfo);
+
+            const IntensiveQuantities& up = upIsInterior ? intQuantsIn : intQuantsEx;
+            const auto& upFs = up.fluidState();
+
+            // only the interior cell contributes derivatives
+            Evaluation darcyFlux;
+            if (upIsInterior) {
+                darcyFlux = pressureDifference * up.mobility(phaseIdx) * (-trans / faceArea);
+            }
+            else {
+                darcyFlux = pressureDifference *
+                    (Toolbox::value(up.mobility(phaseIdx)) * (-trans / faceArea));
+            }
+
+            if (phaseIdx < numEq) {
+                darcy[phaseIdx] = darcyFlux.value() * faceArea;
+            }
+
+            if (upIsInterior) {
+                addPhaseFlux_<Evaluation>(flux, phaseIdx, darcyFlux, upFs);
+            }
+            else {
+                addPhaseFlux_<Scalar>(flux, phaseIdx, darcyFlux, upFs);
+            }
+        }
+    }
+
+    /*!
+     * \brief Compute the flux over a boundary face.
+     *
+     * Only the trivial (no-flow) boundary condition is supported by the
+     * compositional model.
+     */
+    template <class BoundaryConditionData>
+    static void computeBoundaryFlux(RateVector& bdyFlux,
+                                    const Problem& /* problem */,
+                                    const BoundaryConditionData& bdyInfo,
+                                    const IntensiveQuantities& /* insideIntQuants */,
+                                    unsigned /* globalSpaceIdx */)
+    {
+        if (bdyInfo.type != BCType::NONE) {
+            throw std::logic_error("boundary condition is not supported by compostional modeling yet");
+        }
+        bdyFlux = 0.0;
+    }
+
+    /*!
+     * \brief Compute the source term of a cell, including wells and aquifers.
+     */
+    static void computeSource(RateVector& source,
+                              const Problem& problem,
+                              const IntensiveQuantities& /* insideIntQuants */,
+                              unsigned globalSpaceIdx,
+                              unsigned timeIdx)
+    {
+        OPM_TIMEBLOCK_LOCAL(computeSource, Subsystem::Assembly);
+        problem.source(source, globalSpaceIdx, timeIdx);
+    }
+
+    /*!
+     * \brief Compute the source term of a cell, excluding wells and aquifers.
+     */
+    static void computeSourceDense(RateVector& source,
+                                   const Problem& problem,
+                                   const IntensiveQuantities& /* insideIntQuants */,
+                                   unsigned globalSpaceIdx,
+                                   unsigned timeIdx)
+    {
+        source = 0.0;
+        problem.addToSourceDense(source, globalSpaceIdx, timeIdx);
+    }
+
+private:
+    // Computes the difference of the phase potentials of the exterior and the
+    // interior cell, and returns true if the interior cell is upstream.
+    static bool calculatePhasePressureDiff_(Evaluation& pressureDifference,
+                                            const IntensiveQuantities& intQuantsIn,
+                                            const IntensiveQuantities& intQuantsEx,
+                                            const unsigned phaseIdx,
+                                            const unsigned globalIndexIn,
+                                            const unsigned globalIndexEx,
+                                            const ResidualNBInfo& nbInfo)
+    {
+        // if the phase is immobile in both cells, there is no flux
+        if (intQuantsIn.mobility(phaseIdx) <= 0.0 &&
+            intQuantsEx.mobility(phaseIdx) <= 0.0)
+        {
+            pressureDifference = 0.0;
+            return true;
+        }
+
+        // gravity correction using the average density of the two cells
+        const auto& fsIn = intQuantsIn.fluidState();
+        const auto& fsEx = intQuantsEx.fluidState();
+        const Evaluation rhoAvg = (fsIn.density(phaseIdx) +
+                                   Toolbox::value(fsEx.density(phaseIdx))) / 2;
+
+        pressureDifference = Toolbox::value(fsEx.pressure(phaseIdx)) + rhoAvg * nbInfo.dZg
+            - fsIn.pressure(phaseIdx);
+
+        // if the potentials are equal, the cell with the larger volume, and
+        // then the one with the smaller index is upstream
+        bool upIsInterior;
+        if (pressureDifference != 0.0) {
+            upIsInterior = pressureDifference < 0.0;
+        }
+        else if (nbInfo.Vin != nbInfo.Vex) {
+            upIsInterior = nbInfo.Vin > nbInfo.Vex;
+        }
+        else {
+            upIsInterior = globalIndexIn < globalIndexEx;
+        }
+
+        const Scalar thpres = nbInfo.thpres;
+        if (thpres > 0.0) {
+            if (std::abs(Toolbox::value(pressureDifference)) > thpres) {
+                if (pressureDifference < 0.0) {
+                    pressureDifference += thpres;
+                }
+                else {
+                    pressureDifference -= thpres;
+                }
+            }
+            else {
+                pressureDifference = 0.0;
+            }
+        }
+
+        return upIsInterior;
+    }
+
+    // Adds the mass fluxes of all components carried by a phase, evaluating
+    // the upstream quantities as UpEval.
+    template <class UpEval, class FluidState>
+    static void addPhaseFlux_(RateVector& flux,
+                              const unsigned phaseIdx,
+                              const Evaluation& darcyFlux,
+                              const FluidState& upFs)
+    {
+        const Evaluation massFlux =
+            Toolbox::template decay<UpEval>(upFs.density(phaseIdx)) * darcyFlux;
+
+        if (waterEnabled && phaseIdx == static_cast<unsigned int>(waterPhaseIdx)) {
+            flux[conti0EqIdx + numComponents] += massFlux;
+        }
+        else {
+            for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                flux[conti0EqIdx + compIdx] +=
+                    massFlux * Toolbox::template decay<UpEval>(upFs.massFraction(phaseIdx, compIdx));
+            }
+        }
+    }
+};
+
+} // namespace Opm
+
+#endif
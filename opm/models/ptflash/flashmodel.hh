@@ -48,6 +48,8 @@
 #include <opm/models/io/vtkenergymodule.hpp>
 #include <opm/models/io/vtkptflashmodule.hpp>
 
+#include <opm/models/parallel/threadedentityiterator.hh>
+
 #include <opm/models/ptflash/flashindices.hh>
 #include <opm/models/ptflash/flashintensivequantities.hh>
 #include <opm/models/ptflash/flashlocalresidual.hh>
@@ -58,6 +60,7 @@
 #include <cassert>
 #include <memory>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <tuple>
 
@@ -197,6 +200,9 @@ class FlashModel
     using Scalar = GetPropType<TypeTag, Properties::Scalar>;
     using FluidSystem = GetPropType<TypeTag, Properties::FluidSystem>;
     using Simulator = GetPropType<TypeTag, Properties::Simulator>;
+    using ElementContext = GetPropType<TypeTag, Properties::ElementContext>;
+    using GridView = GetPropType<TypeTag, Properties::GridView>;
+    using IntensiveQuantities = GetPropType<TypeTag, Properties::IntensiveQuantities>;
 
     using Indices = GetPropType<TypeTag, Properties::Indices>;
 
@@ -239,6 +245,15 @@ public:
         Parameters::Register<Parameters::FlashTwoPhaseMethod>
             ("Method for solving vapor-liquid composition. Available options include: "
              "ssi, newton, ssi+newton");
+        Parameters::Register<Parameters::FlashCachePhaseState>
+            ("Skip the flash of cells which were single-phase in their last flash if their "
+             "composition, pressure and temperature have changed little since then");
+        Parameters::Register<Parameters::FlashCacheCompositionTolerance<Scalar>>
+            ("Maximum change of an overall mole fraction since the last flash for which "
+             "a cell's cached single-phase state is reused");
+        Parameters::Register<Parameters::FlashCacheRelativeTolerance<Scalar>>
+            ("Maximum relative change of pressure and temperature since the last flash "
+             "for which a cell's cached single-phase state is reused");
 
         Parameters::SetDefault<Parameters::FlashTolerance<Scalar>>(1.e-8);
         Parameters::SetDefault<Parameters::EnableIntensiveQuantityCache>(true);
@@ -249,6 +264,52 @@ public:
         Parameters::SetDefault<Parameters::EnableThermodynamicHints>(true);
     }
 
+    /*!
+     * \brief Return the cached intensive quantities of a degree of freedom.
+     *
+     * This is used by linearizers which do not compute the intensive quantities
+     * themselves, like the TpfaLinearizer. The cache entry must be up to date, see
+     * updateInvalidIntensiveQuantities().
+     */
+    const IntensiveQuantities& intensiveQuantities(unsigned globalIdx, unsigned timeIdx) const
+    {
+        if (!this->enableIntensiveQuantityCache_) {
+            throw std::logic_error("The intensive quantity cache is required by the linearizer: "
+                                   "Use --enable-intensive-quantity-cache=true");
+        }
+
+        const auto* intQuants = this->cachedIntensiveQuantities(globalIdx, timeIdx);
+        if (!intQuants) {
+            throw std::logic_error("Intensive quantities of degree of freedom "
+                                   + std::to_string(globalIdx) + " are not up to date");
+        }
+        return *intQuants;
+    }
+
+    /*!
+     * \brief Compute the intensive quantities of all degrees of freedom whose cache
+     *        entry is not up to date.
+     */
+    void updateInvalidIntensiveQuantities(unsigned timeIdx) const
+    {
+        ThreadedEntityIterator<GridView, /*codim=*/0> threadedElemIt(this->gridView_);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            ElementContext elemCtx(this->simulator_);
+            auto elemIt = threadedElemIt.beginParallel();
+            for (; !threadedElemIt.isFinished(elemIt); elemIt = threadedElemIt.increment()) {
+                const auto& elem = *elemIt;
+                if (this->cachedIntensiveQuantities(this->elementMapper().index(elem), timeIdx)) {
+                    continue;
+                }
+                elemCtx.updatePrimaryStencil(elem);
+                elemCtx.updatePrimaryIntensiveQuantities(timeIdx);
+            }
+        }
+    }
+
     /*!
      * \copydoc FvBaseDiscretization::primaryVarName
      */
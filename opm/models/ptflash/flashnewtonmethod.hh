@@ -32,9 +32,15 @@
 
 #include <opm/models/common/multiphasebaseproperties.hh>
 #include <opm/models/nonlinear/newtonmethod.hh>
+#include <opm/models/ptflash/flashparameters.hh>
+#include <opm/models/utils/parametersystem.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <type_traits>
 
 namespace Opm::Properties {
 
@@ -45,6 +51,9 @@ struct DiscNewtonMethod;
 
 namespace Opm {
 
+template <class TypeTag>
+class TpfaLinearizer;
+
 /*!
  * \ingroup FlashModel
  *
@@ -60,6 +69,7 @@ class FlashNewtonMethod : public GetPropType<TypeTag, Properties::DiscNewtonMeth
     using Simulator = GetPropType<TypeTag, Properties::Simulator>;
     using Scalar = GetPropType<TypeTag, Properties::Scalar>;
     using Indices = GetPropType<TypeTag, Properties::Indices>;
+    using IntensiveQuantities = GetPropType<TypeTag, Properties::IntensiveQuantities>;
 
     enum { pressure0Idx = Indices::pressure0Idx };
     enum { z0Idx = Indices::z0Idx };
@@ -67,6 +77,11 @@ class FlashNewtonMethod : public GetPropType<TypeTag, Properties::DiscNewtonMeth
 
     static constexpr bool waterEnabled = Indices::waterEnabled;
 
+    // The TPFA linearizer reads the intensive quantities from the cache of the model
+    // instead of computing them itself, so the cache must be kept up to date.
+    static constexpr bool linearizerUsesCache =
+        std::is_same_v<GetPropType<TypeTag, Properties::Linearizer>, TpfaLinearizer<TypeTag>>;
+
 public:
     /*!
      * \copydoc FvBaseNewtonMethod::FvBaseNewtonMethod(Problem& )
@@ -78,6 +93,58 @@ protected:
     friend ParentType;
     friend NewtonMethod<TypeTag>;
 
+    /*!
+     * \copydoc NewtonMethod::linearizeDomain_
+     */
+    void linearizeDomain_()
+    {
+        if constexpr (linearizerUsesCache) {
+            this->model().updateInvalidIntensiveQuantities(/*timeIdx=*/0);
+        }
+        ParentType::linearizeDomain_();
+    }
+
+    /*!
+     * \copydoc NewtonMethod::succeeded_
+     *
+     * Brings the intensive quantities up to date with the converged solution, since
+     * code run at the end of the time step may access them through the model.
+     */
+    void succeeded_()
+    {
+        ParentType::succeeded_();
+        if constexpr (linearizerUsesCache) {
+            this->model().updateInvalidIntensiveQuantities(/*timeIdx=*/0);
+        }
+    }
+
+    /*!
+     * \copydoc NewtonMethod::end_
+     *
+     * Also reports the statistics of the cached phase state mode of the flash.
+     */
+    void end_()
+    {
+        ParentType::end_();
+
+        if (!Parameters::Get<Parameters::FlashCachePhaseState>()) {
+            return;
+        }
+
+        auto& statistics = IntensiveQuantities::cacheStatistics();
+        std::array<std::size_t, 2> counts{statistics.flashes.exchange(0),
+                                          statistics.skipped.exchange(0)};
+        this->simulator_.gridView().comm().sum(counts.data(), counts.size());
+
+        if (this->verbose_()) {
+            const std::size_t total = counts[0] + counts[1];
+            std::cout << "Flash calculations: " << counts[0]
+                      << ", skipped using cached phase state: " << counts[1]
+                      << " (" << (total > 0 ? 100.0 * counts[1] / total : 0.0) << "%)\n"
+                      << std::flush;
+        }
+    }
+
     /*!
      * \copydoc FvBaseNewtonMethod::updatePrimaryVariables_
      */
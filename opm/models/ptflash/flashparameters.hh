@@ -40,6 +40,18 @@ struct FlashTwoPhaseMethod { static constexpr auto value = "ssi"; };
 //! The verbosity level of the flash solver
 struct FlashVerbosity { static constexpr int value = 0; };
 
+//! Reuse the phase state of cells which were single-phase in their last flash
+//! instead of redoing the flash if their state has changed little since then
+struct FlashCachePhaseState { static constexpr bool value = false; };
+
+//! Maximum change of an overall mole fraction for reusing a cached phase state
+template<class Scalar>
+struct FlashCacheCompositionTolerance { static constexpr Scalar value = 1e-3; };
+
+//! Maximum relative change of pressure and temperature for reusing a cached phase state
+template<class Scalar>
+struct FlashCacheRelativeTolerance { static constexpr Scalar value = 1e-2; };
+
 } // namespace Opm::Parameters
 
 #endif
@@ -64,6 +64,7 @@ public:
     using RateVector = GetPropType<TypeTag, Properties::RateVector>;
     using IntensiveQuantities = GetPropType<TypeTag, Properties::IntensiveQuantities>;
     using ElementMapper = GetPropType<TypeTag, Properties::ElementMapper>;
+    using CellConnection = typename AquiferInterface<TypeTag>::CellConnection;
 
     static constexpr EnergyModules energyModuleType = getPropValue<TypeTag, Properties::EnergyModuleType>();
     enum { enableBrine = getPropValue<TypeTag, Properties::EnableBrine>() };
@@ -144,19 +145,11 @@ public:
 
     void beginTimeStep() override
     {
-        ElementContext elemCtx(this->simulator_);
+        const auto& model = this->simulator_.model();
         OPM_BEGIN_PARALLEL_TRY_CATCH();
 
-        for (const auto& elem : elements(this->simulator_.gridView())) {
-            elemCtx.updatePrimaryStencil(elem);
-
-            const int cellIdx = elemCtx.globalSpaceIndex(0, 0);
-            const int idx = cellToConnectionIdx_[cellIdx];
-            if (idx < 0)
-                continue;
-
-            elemCtx.updateIntensiveQuantities(0);
-            const auto& iq = elemCtx.intensiveQuantities(0, 0);
+        for (const auto& [cellIdx, idx] : this->cellConnections_) {
+            const auto& iq = model.intensiveQuantities(cellIdx, /*timeIdx=*/0);
             pressure_previous_[idx] = getValue(iq.fluidState().pressure(this->phaseIdx_()));
         }
 
@@ -165,14 +158,13 @@ public:
     }
 
     void addToSource(RateVector& rates,
-                     const unsigned cellIdx,
+                     const CellConnection& conn,
                      const unsigned timeIdx) override
     {
         const auto& model = this->simulator_.model();
 
-        const int idx = this->cellToConnectionIdx_[cellIdx];
-        if (idx < 0)
-            return;
+        const unsigned cellIdx = conn.cellIdx;
+        const int idx = conn.connectionIdx;
 
         const auto& intQuants = model.intensiveQuantities(cellIdx, timeIdx);
 
@@ -285,7 +277,7 @@ protected:
 
         // total_face_area_ is the sum of the areas connected to an aquifer
         this->total_face_area_ = Scalar{0};
-        this->cellToConnectionIdx_.resize(this->simulator_.gridView().size(/*codim=*/0), -1);
+        this->cellConnections_.clear();
         const auto& gridView = this->simulator_.vanguard().gridView();
         for (std::size_t idx = 0; idx < this->size(); ++idx) {
             const auto global_index = this->connections_[idx].global_index;
@@ -302,8 +294,10 @@ protected:
                 continue;
             }
 
-            this->cellToConnectionIdx_[cell_index] = idx;
+            this->cellConnections_.push_back({static_cast<unsigned>(cell_index),
+                                              static_cast<unsigned>(idx)});
         }
+        this->finalizeCellConnections_();
 
         // Translate the C face tag into the enum used by opm-parser's TransMult class
         FaceDir::DirEnum faceDirection;
@@ -312,12 +306,13 @@ protected:
         const auto& elemMapper = this->simulator_.model().dofMapper();
         for (const auto& elem : elements(gridView)) {
             const unsigned cell_index = elemMapper.index(elem);
-            const int idx = this->cellToConnectionIdx_[cell_index];
+            const auto* conn = this->findCellConnection_(cell_index);
 
             // Only deal with connections given by the aquifer
-            if (idx < 0) {
+            if (conn == nullptr) {
                 continue;
             }
+            const unsigned idx = conn->connectionIdx;
 
             for (const auto& intersection : intersections(gridView, elem)) {
                 // Only deal with grid boundaries
@@ -390,18 +385,9 @@ protected:
         std::vector<Scalar> pw_aquifer;
         Scalar water_pressure_reservoir;
 
-        ElementContext elemCtx(this->simulator_);
-        const auto& gridView = this->simulator_.gridView();
-        for (const auto& elem : elements(gridView)) {
-            elemCtx.updatePrimaryStencil(elem);
-
-            const auto cellIdx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-            const auto idx = this->cellToConnectionIdx_[cellIdx];
-            if (idx < 0)
-                continue;
-
-            elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
-            const auto& iq0 = elemCtx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
+        const auto& model = this->simulator_.model();
+        for (const auto& [cellIdx, idx] : this->cellConnections_) {
+            const auto& iq0 = model.intensiveQuantities(cellIdx, /*timeIdx=*/0);
             const auto& fs = iq0.fluidState();
 
             water_pressure_reservoir = fs.pressure(this->phaseIdx_()).value();
@@ -430,7 +416,6 @@ protected:
 
     // Grid variables
     std::vector<Scalar> faceArea_connected_;
-    std::vector<int> cellToConnectionIdx_;
 
     // Quantities at each grid id
     std::vector<Scalar> cell_depth_;
@@ -44,6 +44,7 @@ public:
     using FluidSystem = GetPropType<TypeTag, Properties::FluidSystem>;
     using BlackoilIndices = GetPropType<TypeTag, Properties::Indices>;
     using Scalar = GetPropType<TypeTag, Properties::Scalar>;
+    using CellConnection = typename AquiferInterface<TypeTag>::CellConnection;
 
     static constexpr int numEq = BlackoilIndices::numEq;
     using Eval = GetPropType<TypeTag, Properties::Evaluation>;
@@ -126,13 +127,11 @@ public:
     }
 
     void addToSource(RateVector& rates,
-                     const unsigned cellIdx,
+                     const CellConnection& conn,
                      [[maybe_unused]] const unsigned timeIdx) override
     {
-        const int idx = this->cellToConnectionIdx_[cellIdx];
-        if (idx < 0) {
-            return;
-        }
+        const unsigned cellIdx = conn.cellIdx;
+        const unsigned idx = conn.connectionIdx;
 
         const auto& model = this->simulator_.model();
 
@@ -160,7 +159,6 @@ private:
 
     SingleAquiferFlux aquifer_data_;
     std::vector<Eval> connection_flux_{};
-    std::vector<int> cellToConnectionIdx_{};
     Scalar flux_rate_{};
     Scalar cumulative_flux_{};
     Scalar total_face_area_{0.0};
@@ -170,8 +168,7 @@ private:
     {
         auto connected_face_area = 0.0;
 
-        this->cellToConnectionIdx_
-            .resize(this->simulator_.gridView().size(/*codim=*/0), -1);
+        this->cellConnections_.clear();
 
         for (std::size_t idx = 0; idx < this->connections_.size(); ++idx) {
             const auto global_index = this->connections_[idx].global_index;
@@ -182,10 +179,12 @@ private:
                 continue;
             }
 
-            this->cellToConnectionIdx_[cell_index] = idx;
+            this->cellConnections_.push_back({static_cast<unsigned>(cell_index),
+                                              static_cast<unsigned>(idx)});
 
             connected_face_area += this->connections_[idx].effective_facearea;
         }
+        this->finalizeCellConnections_();
 
         // TODO: At the moment, we are using the effective_facearea from the
         // parser.  Should we update the facearea here if the grid changed
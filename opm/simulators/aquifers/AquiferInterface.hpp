@@ -27,6 +27,10 @@
 
 #include <opm/output/data/Aquifer.hpp>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 namespace Opm
 {
 
@@ -39,6 +43,13 @@ public:
     using Simulator = GetPropType<TypeTag, Properties::Simulator>;
     using Scalar = GetPropType<TypeTag, Properties::Scalar>;
 
+    // An interior cell of this process connected to the aquifer
+    struct CellConnection
+    {
+        unsigned cellIdx;
+        unsigned connectionIdx;
+    };
+
     // Constructor
     AquiferInterface(int aqID,
                      const Simulator& simulator)
@@ -72,13 +83,58 @@ public:
         addToSource(rates, cellIdx, timeIdx);
     }
 
+    void addToSource(RateVector& rates,
+                     const unsigned cellIdx,
+                     const unsigned timeIdx)
+    {
+        if (const auto* conn = this->findCellConnection_(cellIdx)) {
+            addToSource(rates, *conn, timeIdx);
+        }
+    }
+
+    // Add the rate per unit volume of a single connection to the source term
+    // of the connected cell.
     virtual void addToSource(RateVector& rates,
-                             const unsigned cellIdx,
+                             const CellConnection& conn,
                              const unsigned timeIdx) = 0;
 
+    // The interior cells of this process which are connected to the aquifer,
+    // sorted by cell index.
+    const std::vector<CellConnection>& cellConnections() const
+    { return this->cellConnections_; }
+
     int aquiferID() const { return this->aquiferID_; }
 
 protected:
+    // Sort the cell connections by cell index. If a cell is connected by
+    // multiple connections, only the last one is kept.
+    void finalizeCellConnections_()
+    {
+        std::ranges::stable_sort(this->cellConnections_, {}, &CellConnection::cellIdx);
+
+        std::vector<CellConnection> unique;
+        unique.reserve(this->cellConnections_.size());
+        for (const auto& conn : this->cellConnections_) {
+            if (!unique.empty() && unique.back().cellIdx == conn.cellIdx) {
+                unique.back() = conn;
+            }
+            else {
+                unique.push_back(conn);
+            }
+        }
+        this->cellConnections_ = std::move(unique);
+    }
+
+    const CellConnection* findCellConnection_(const unsigned cellIdx) const
+    {
+        const auto it = std::ranges::lower_bound(this->cellConnections_, cellIdx,
+                                                 {}, &CellConnection::cellIdx);
+        if (it == this->cellConnections_.end() || it->cellIdx != cellIdx) {
+            return nullptr;
+        }
+        return &*it;
+    }
+
     bool co2store_or_h2store_() const
     {
         const auto& rspec = simulator_.vanguard().eclState().runspec();
@@ -96,6 +152,8 @@ protected:
 
     const int aquiferID_{};
     const Simulator& simulator_;
+
+    std::vector<CellConnection> cellConnections_{};
 };
 
 } // namespace Opm
@@ -62,6 +62,7 @@ public:
     using Toolbox = MathToolbox<Eval>;
 
     using typename AquiferInterface<TypeTag>::RateVector;
+    using typename AquiferInterface<TypeTag>::CellConnection;
 
     // Constructor
     AquiferNumerical(const SingleNumericalAquifer& aquifer,
@@ -122,7 +123,9 @@ public:
     }
 
     void beginTimeStep() override {}
-    void addToSource(RateVector&, const unsigned, const unsigned) override {}
+    void addToSource(RateVector&,
+                     const CellConnection&,
+                     const unsigned) override {}
 
     void endTimeStep() override
     {
@@ -65,6 +65,11 @@ public:
     template <class Context>
     void addToSource(RateVector& rates, const Context& context, unsigned spaceIdx, unsigned timeIdx) const;
     void addToSource(RateVector& rates, unsigned globalSpaceIdx, unsigned timeIdx) const;
+    // add the aquifer contributions of all connected cells to the residual and
+    // the diagonal of the Jacobian, used with separate sparse source terms.
+    template <class GlobalEqVector, class MatrixBlock>
+    void addReservoirSourceTerms(GlobalEqVector& residual,
+                                 const std::vector<MatrixBlock*>& diagMatAddress) const;
     void endIteration();
     void endTimeStep();
     void endEpisode();
@@ -90,6 +95,15 @@ protected:
     // TODO: possibly better to use unorder_map here for aquifers
     std::vector<std::unique_ptr<AquiferInterface<TypeTag>>> aquifers;
 
+    // The cells connected to any aquifer, sorted by cell index. Connections of
+    // the same cell keep the order of the aquifers.
+    struct ConnectedCell
+    {
+        typename AquiferInterface<TypeTag>::CellConnection connection;
+        AquiferInterface<TypeTag>* aquifer;
+    };
+    std::vector<ConnectedCell> connectedCells_;
+
     // This initialization function is used to connect the parser objects
     // with the ones needed by AquiferCarterTracy
     void init();
@@ -109,6 +123,8 @@ private:
                                  std::string_view   aqType) const;
 
     void computeConnectionAreaFraction() const;
+
+    void updateConnectedCells();
 };
 
 } // namespace Opm
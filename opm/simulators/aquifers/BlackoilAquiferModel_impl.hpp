@@ -83,6 +83,7 @@ BlackoilAquiferModel<TypeTag>::beginEpisode()
     // SCHEDULE setup in this section it is the beginning of a report step
 
     this->createDynamicAquifers(this->simulator_.episodeIndex());
+    this->updateConnectedCells();
 
     this->computeConnectionAreaFraction();
 }
@@ -109,9 +110,7 @@ BlackoilAquiferModel<TypeTag>::addToSource(RateVector& rates,
                                            unsigned spaceIdx,
                                            unsigned timeIdx) const
 {
-    for (auto& aquifer : this->aquifers) {
-        aquifer->addToSource(rates, context, spaceIdx, timeIdx);
-    }
+    this->addToSource(rates, context.globalSpaceIndex(spaceIdx, timeIdx), timeIdx);
 }
 
 template <typename TypeTag>
@@ -120,8 +119,46 @@ BlackoilAquiferModel<TypeTag>::addToSource(RateVector& rates,
                                            unsigned globalSpaceIdx,
                                            unsigned timeIdx) const
 {
-    for (auto& aquifer : this->aquifers) {
-        aquifer->addToSource(rates, globalSpaceIdx, timeIdx);
+    const auto [first, last] =
+        std::ranges::equal_range(this->connectedCells_, globalSpaceIdx, {},
+                                 [](const ConnectedCell& cell)
+                                 { return cell.connection.cellIdx; });
+    for (auto it = first; it != last; ++it) {
+        it->aquifer->addToSource(rates, it->connection, timeIdx);
+    }
+}
+
+template <typename TypeTag>
+template <class GlobalEqVector, class MatrixBlock>
+void
+BlackoilAquiferModel<TypeTag>::
+addReservoirSourceTerms(GlobalEqVector& residual,
+                        const std::vector<MatrixBlock*>& diagMatAddress) const
+{
+    constexpr bool enableFullyImplicitThermal =
+        getPropValue<TypeTag, Properties::EnergyModuleType>() == EnergyModules::FullyImplicitThermal;
+
+    const auto& model = this->simulator_.model();
+    // NB this loop may write multiple times to the same element
+    // if a cell is connected to more than one aquifer, so it should
+    // not be OpenMP-parallelized.
+    for (const auto& cell : this->connectedCells_) {
+        const unsigned cellIdx = cell.connection.cellIdx;
+        RateVector rate(0.0);
+        cell.aquifer->addToSource(rate, cell.connection, /*timeIdx=*/0);
+        if constexpr (enableFullyImplicitThermal) {
+            using Indices = GetPropType<TypeTag, Properties::Indices>;
+            rate[Indices::contiEnergyEqIdx]
+                *= getPropValue<TypeTag, Properties::BlackOilEnergyScalingFactor>();
+        }
+        // the aquifers provide rates per unit volume
+        rate *= -model.dofTotalVolume(cellIdx);
+
+        typename GlobalEqVector::block_type res(0.0);
+        MatrixBlock bMat(0.0);
+        model.linearizer().setResAndJacobi(res, bMat, rate);
+        residual[cellIdx] += res;
+        *diagMatAddress[cellIdx] += bMat;
     }
 }
 
@@ -179,6 +216,8 @@ void BlackoilAquiferModel<TypeTag>::init()
     if (this->needRestartDynamicAquifers()) {
         this->initializeRestartDynamicAquifers();
     }
+
+    this->updateConnectedCells();
 }
 
 template<typename TypeTag>
@@ -373,6 +412,21 @@ void BlackoilAquiferModel<TypeTag>::computeConnectionAreaFraction() const
     }
 }
 
+template <typename TypeTag>
+void BlackoilAquiferModel<TypeTag>::updateConnectedCells()
+{
+    this->connectedCells_.clear();
+    for (const auto& aquifer : this->aquifers) {
+        for (const auto& conn : aquifer->cellConnections()) {
+            this->connectedCells_.push_back({conn, aquifer.get()});
+        }
+    }
+
+    std::ranges::stable_sort(this->connectedCells_, {},
+                             [](const ConnectedCell& cell)
+                             { return cell.connection.cellIdx; });
+}
+
 } // namespace Opm
 
 #endif
@@ -34,6 +34,7 @@
 #include <opm/output/data/Aquifer.hpp>
 
 #include <stdexcept>
+#include <vector>
 
 namespace Opm {
 
@@ -114,6 +115,15 @@ public:
                      unsigned) const
     { }
 
+    /*!
+     * \brief Add the aquifer contributions of all connected cells to the residual
+     *        and the diagonal of the Jacobian.
+     */
+    template <class GlobalEqVector, class MatrixBlock>
+    void addReservoirSourceTerms(GlobalEqVector&,
+                                 const std::vector<MatrixBlock*>&) const
+    { }
+
 
     /*!
      * \brief This method is called after each Newton-Raphson successful iteration.
@@ -42,8 +42,13 @@
 
 #include <opm/simulators/wells/BlackoilWellModel.hpp>
 
+#include <opm/grid/CpGrid.hpp>
+#include <opm/grid/utility/ElementChunks.hpp>
+
 #include <memory>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -63,6 +68,7 @@ public:
     // ---------  Types and enums  ---------
     using Simulator = GetPropType<TypeTag, Properties::Simulator>;
     using Grid = GetPropType<TypeTag, Properties::Grid>;
+    using GridView = GetPropType<TypeTag, Properties::GridView>;
     using ElementContext = GetPropType<TypeTag, Properties::ElementContext>;
     using IntensiveQuantities = GetPropType<TypeTag, Properties::IntensiveQuantities>;
     using SparseMatrixAdapter = GetPropType<TypeTag, Properties::SparseMatrixAdapter>;
@@ -225,6 +231,8 @@ public:
     /// "relaxed converged", "unconverged" cells based on CNV point
     /// measures. Also returns list of cells where CNV is greater than
     /// its strict tolerance
+    /// \details Uses the cells and pore volumes recorded by the preceding
+    ///          call to localConvergenceData(), the grid is not traversed.
     CnvPvSplitData characteriseCnvPvSplit(const std::vector<Scalar>& B_avg, const double dt);
 
     /// \brief Compute the number of Newtons required by each cell in order to
@@ -374,6 +382,13 @@ protected:
     std::unique_ptr<BlackoilModelNldd<TypeTag>> nlddSolver_; //!< Non-linear DD solver
     BlackoilModelConvergenceMonitor<Scalar> conv_monitor_;
 
+    static constexpr bool gridIsUnchanging = std::is_same_v<Grid, Dune::CpGrid>;
+    //! Element chunks for threaded convergence checks, only used if the grid is unchanging
+    std::unique_ptr<ElementChunks<GridView, Dune::Partitions::All>> element_chunks_;
+    //! Interior cells outside numerical aquifers and their pore volumes,
+    //! recorded by localConvergenceData() for the CNV split
+    std::vector<std::pair<unsigned, Scalar>> cnvCellPv_;
+
 private:
     Scalar dpMaxRel() const { return param_.dp_max_rel_; }
     Scalar dsMax() const { return param_.ds_max_; }
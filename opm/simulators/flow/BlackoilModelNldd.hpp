@@ -65,6 +65,7 @@
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <exception>
 #include <filesystem>
 #include <memory>
 #include <numeric>
@@ -75,6 +76,10 @@
 #include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace Opm {
 
 template<class TypeTag> class BlackoilModel;
@@ -99,6 +104,16 @@ public:
 
     static constexpr int numEq = Indices::numEq;
 
+    //! \brief Whether the linearizer can linearize subdomains concurrently.
+    static constexpr bool linearizerSupportsConcurrentDomains =
+        requires (GetPropType<TypeTag, Properties::Linearizer>& linearizer,
+                  const std::vector<Domain>& domains)
+        {
+            linearizer.freezeSubdomainNeighbors(domains);
+            linearizer.releaseSubdomainNeighbors();
+            linearizer.canLinearizeSubdomainsConcurrently();
+        };
+
     //! \brief The constructor sets up the subdomains.
     //! \param model BlackOil model to solve for
     //! \param param param Model parameters
@@ -218,6 +233,8 @@ public:
 
         domain_reports_accumulated_.resize(num_domains);
 
+        num_solve_threads_ = this->concurrentSolveThreads();
+
         // Print domain distribution summary
         ::Opm::printDomainDistributionSummary(
             partition_vector,
@@ -282,42 +299,48 @@ public:
         std::vector<SimulatorReportSingle> domain_reports(domains_.size());
 
         OPM_BEGIN_PARALLEL_TRY_CATCH()
-        for (const int domain_index : domain_order) {
-            const auto& domain = domains_[domain_index];
-            SimulatorReportSingle local_report;
-            detailTimer.reset();
-            detailTimer.start();
+        if (num_solve_threads_ > 1) {
+            solveDomainsConcurrently(domain_order, solution, locally_solved,
+                                     domain_reports, logger, timer);
+        }
+        else {
+            for (const int domain_index : domain_order) {
+                const auto& domain = domains_[domain_index];
+                SimulatorReportSingle local_report;
+                detailTimer.reset();
+                detailTimer.start();
 
-            domain_needs_solving_[domain_index] = checkIfSubdomainNeedsSolving(domain);
+                domain_needs_solving_[domain_index] = checkIfSubdomainNeedsSolving(domain);
 
-            updateMobilities(domain);
+                updateMobilities(domain);
 
-            if (domain.skip || !domain_needs_solving_[domain_index]) {
-                local_report.skipped_domains = true;
-                local_report.converged = true;
+                if (domain.skip || !domain_needs_solving_[domain_index]) {
+                    local_report.skipped_domains = true;
+                    local_report.converged = true;
+                    domain_reports[domain.index] = local_report;
+                    continue;
+                }
+                switch (model_.param().local_solve_approach_) {
+                case DomainSolveApproach::Jacobi:
+                    solveDomainJacobi(solution, locally_solved, local_report, logger,
+                                      timer, domain);
+                    break;
+                default:
+                case DomainSolveApproach::GaussSeidel:
+                    solveDomainGaussSeidel(solution, locally_solved, local_report, logger,
+                                           timer, domain);
+                    break;
+                }
+                // This should have updated the global matrix to be
+                // dR_i/du_j evaluated at new local solutions for
+                // i == j, at old solution for i != j.
+                if (!local_report.converged) {
+                    // TODO: more proper treatment, including in parallel.
+                    logger.debug(fmt::format("Convergence failure in domain {} on rank {}." , domain.index, rank_));
+                }
+                local_report.solver_time += detailTimer.stop();
                 domain_reports[domain.index] = local_report;
-                continue;
-            }
-            switch (model_.param().local_solve_approach_) {
-            case DomainSolveApproach::Jacobi:
-                solveDomainJacobi(solution, locally_solved, local_report, logger,
-                                  timer, domain);
-                break;
-            default:
-            case DomainSolveApproach::GaussSeidel:
-                solveDomainGaussSeidel(solution, locally_solved, local_report, logger,
-                                       timer, domain);
-                break;
-            }
-            // This should have updated the global matrix to be
-            // dR_i/du_j evaluated at new local solutions for
-            // i == j, at old solution for i != j.
-            if (!local_report.converged) {
-                // TODO: more proper treatment, including in parallel.
-                logger.debug(fmt::format("Convergence failure in domain {} on rank {}." , domain.index, rank_));
             }
-            local_report.solver_time += detailTimer.stop();
-            domain_reports[domain.index] = local_report;
         }
         OPM_END_PARALLEL_TRY_CATCH("Unexpected exception in local domain solve: ", model_.simulator().vanguard().grid().comm());
 
@@ -563,7 +586,7 @@ private:
                 local_report.linear_solve_time += detailTimer.stop();
                 local_report.linear_solve_setup_time += setup_time;
                 local_report.total_linear_iterations = domain_linsolvers_[domain.index].iterations();
-                modelSimulator.problem().endIteration();
+                this->endLocalIteration();
                 local_report.converged = false;
                 local_report.total_newton_iterations = localCtx.iteration();
                 local_report.total_linearizations += localCtx.iteration();
@@ -633,7 +656,7 @@ private:
             }
         } while (!convreport.converged() && localCtx.iteration() <= max_iter);
 
-        modelSimulator.problem().endIteration();
+        this->endLocalIteration();
 
         local_report.converged = convreport.converged();
         local_report.total_newton_iterations = localCtx.iteration();
@@ -642,6 +665,131 @@ private:
         return convreport;
     }
 
+    //! \brief Finish a local solve. When domains are solved concurrently,
+    //! this is done once for all of them by solveDomainsConcurrently().
+    void endLocalIteration()
+    {
+        if (!solving_concurrently_) {
+            model_.simulator().problem().endIteration();
+        }
+    }
+
+    //! \brief Number of threads used to solve the subdomains, 1 if they are solved one by one.
+    int concurrentSolveThreads() const
+    {
+        const int requested = model_.param().nldd_local_solve_threads_;
+        if (requested <= 1) {
+            return 1;
+        }
+#ifdef _OPENMP
+        std::string reason;
+        if (model_.param().local_solve_approach_ != DomainSolveApproach::Jacobi) {
+            reason = "the result of the Gauss-Seidel approach depends on the solve order";
+        }
+        else if constexpr (!linearizerSupportsConcurrentDomains) {
+            reason = "the linearizer does not support it";
+        }
+        else if (!model_.simulator().model().linearizer().canLinearizeSubdomainsConcurrently()) {
+            reason = "it is not supported with separate sparse source terms";
+        }
+        if (reason.empty()) {
+            return requested;
+        }
+        if (rank_ == 0) {
+            OpmLog::warning(fmt::format("Solving NLDD subdomains one by one, "
+                                        "since {}.", reason));
+        }
+#else
+        if (rank_ == 0) {
+            OpmLog::warning("Solving NLDD subdomains one by one, "
+                            "since the simulator was built without OpenMP.");
+        }
+#endif
+        return 1;
+    }
+
+    //! \brief Solve the subdomains concurrently, with the Jacobi approach.
+    //!
+    //! Each thread solves one domain at a time, linearizing against copies
+    //! of the neighbouring cells' intensive quantities taken before any
+    //! solve starts. As the Jacobi approach resets the solution of each
+    //! domain after its solve, this gives the same result as solving the
+    //! domains one by one.
+    template<class GlobalEqVector>
+    void solveDomainsConcurrently(const std::vector<int>& domain_order,
+                                  GlobalEqVector& solution,
+                                  GlobalEqVector& locally_solved,
+                                  std::vector<SimulatorReportSingle>& domain_reports,
+                                  DeferredLogger& logger,
+                                  const SimulatorTimerInterface& timer)
+    {
+        OPM_TIMEBLOCK(solveDomainsConcurrently);
+        // Decide which domains to solve. This reads intensive quantities
+        // that the domain solves update, so it must be done up front.
+        std::vector<int> to_solve;
+        to_solve.reserve(domain_order.size());
+        for (const int domain_index : domain_order) {
+            const auto& domain = domains_[domain_index];
+            domain_needs_solving_[domain_index] = checkIfSubdomainNeedsSolving(domain);
+            updateMobilities(domain);
+            if (domain.skip || !domain_needs_solving_[domain_index]) {
+                SimulatorReportSingle local_report;
+                local_report.skipped_domains = true;
+                local_report.converged = true;
+                domain_reports[domain.index] = local_report;
+            }
+            else {
+                to_solve.push_back(domain_index);
+            }
+        }
+
+        if constexpr (linearizerSupportsConcurrentDomains) {
+            model_.simulator().model().linearizer().freezeSubdomainNeighbors(domains_);
+        }
+        model_.wellModel().prepareCellRatesForConcurrentDomains();
+
+        const int num_to_solve = to_solve.size();
+        std::vector<DeferredLogger> domain_loggers(num_to_solve);
+        std::vector<std::exception_ptr> errors(num_to_solve);
+        solving_concurrently_ = true;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_solve_threads_)
+#endif
+        for (int ii = 0; ii < num_to_solve; ++ii) {
+            const auto& domain = domains_[to_solve[ii]];
+            SimulatorReportSingle local_report;
+            Dune::Timer domainTimer;
+            domainTimer.start();
+            try {
+                solveDomainJacobi(solution, locally_solved, local_report, domain_loggers[ii],
+                                  timer, domain);
+            }
+            catch (...) {
+                errors[ii] = std::current_exception();
+            }
+            if (!local_report.converged) {
+                domain_loggers[ii].debug(fmt::format("Convergence failure in domain {} on rank {}.",
+                                                     domain.index, rank_));
+            }
+            local_report.solver_time += domainTimer.stop();
+            domain_reports[domain.index] = local_report;
+        }
+        solving_concurrently_ = false;
+
+        if constexpr (linearizerSupportsConcurrentDomains) {
+            model_.simulator().model().linearizer().releaseSubdomainNeighbors();
+        }
+        for (const auto& domain_logger : domain_loggers) {
+            logger.append(domain_logger);
+        }
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+        model_.simulator().problem().endIteration();
+    }
+
     /// Assemble the residual and Jacobian of the nonlinear system.
     void assembleReservoirDomain(const Domain& domain)
     {
@@ -1231,6 +1379,10 @@ private:
     std::vector<Scalar> previousMobilities_;
     // Flag indicating if this domain should be solved in the next iteration
     std::vector<bool> domain_needs_solving_;
+    // Number of threads solving subdomains concurrently, see concurrentSolveThreads()
+    int num_solve_threads_ = 1;
+    // Set while solveDomainsConcurrently() runs the domain solves
+    bool solving_concurrently_ = false;
 };
 
 } // namespace Opm
@@ -102,6 +102,7 @@ BlackoilModelParameters<Scalar>::BlackoilModelParameters()
     newton_max_iter_ = Parameters::Get<Parameters::NewtonMaxIterations>();
     newton_min_iter_ = Parameters::Get<Parameters::NewtonMinIterations>();
     nldd_num_initial_newton_iter_ = Parameters::Get<Parameters::NlddNumInitialNewtonIter>();
+    nldd_local_solve_threads_ = std::max(1, Parameters::Get<Parameters::NlddLocalSolveThreads>());
     nldd_relative_mobility_change_tol_ = Parameters::Get<Parameters::NlddRelativeMobilityChangeTol<Scalar>>();
     num_local_domains_ = Parameters::Get<Parameters::NumLocalDomains>();
     local_domains_partition_imbalance_ = std::max(Scalar{1.0}, Parameters::Get<Parameters::LocalDomainsPartitioningImbalance<Scalar>>());
@@ -281,6 +282,9 @@ void BlackoilModelParameters<Scalar>::registerParameters()
         ("Set lower than 1.0 to use stricter convergence tolerance for local solves.");
     Parameters::Register<Parameters::NlddNumInitialNewtonIter>
         ("Number of initial global Newton iterations when running the NLDD nonlinear solver.");
+    Parameters::Register<Parameters::NlddLocalSolveThreads>
+        ("Number of threads solving NLDD subdomains concurrently. Only used with the "
+         "jacobi local solve approach. Each subdomain solve then runs single-threaded.");
     Parameters::Register<Parameters::NlddRelativeMobilityChangeTol<Scalar>>
         ("Threshold for single cell relative mobility change in the NLDD solver");
     Parameters::Register<Parameters::NumLocalDomains>
@@ -166,6 +166,7 @@ struct LocalToleranceScalingMb { static constexpr Scalar value = 1.0; };
 template<class Scalar>
 struct LocalToleranceScalingCnv { static constexpr Scalar value = 0.1; };
 struct NlddNumInitialNewtonIter { static constexpr int value = 1; };
+struct NlddLocalSolveThreads { static constexpr int value = 1; };
 template<class Scalar>
 struct NlddRelativeMobilityChangeTol { static constexpr Scalar value = 0.1; };
 struct NumLocalDomains { static constexpr int value = 0; };
@@ -377,6 +378,8 @@ public:
     Scalar local_tolerance_scaling_cnv_;
 
     int nldd_num_initial_newton_iter_{1};
+    /// Number of threads solving NLDD subdomains concurrently (Jacobi only)
+    int nldd_local_solve_threads_{1};
     /// Threshold for single cell relative mobility change in NLDD
     Scalar nldd_relative_mobility_change_tol_;
     int num_local_domains_{0};
@@ -34,9 +34,13 @@
 #include <opm/common/ErrorMacros.hpp>
 #include <opm/common/OpmLog/OpmLog.hpp>
 
+#include <opm/models/parallel/threadmanager.hpp>
+
 #include <opm/simulators/flow/countGlobalCells.hpp>
+#include <opm/simulators/utils/sumMaxReduction.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <filesystem>
 #include <functional>
@@ -90,6 +94,10 @@ BlackoilModel(Simulator& simulator,
 {
     // compute global sum of number of cells
     global_nc_ = detail::countGlobalCells(grid_);
+    if constexpr (gridIsUnchanging) {
+        element_chunks_ = std::make_unique<ElementChunks<GridView, Dune::Partitions::All>>
+            (simulator_.gridView(), Dune::Partitions::all, ThreadManager::maxThreads());
+    }
     convergence_reports_.reserve(300); // Often insufficient, but avoids frequent moves.
     // TODO: remember to fix!
     if (param_.nonlinear_solver_ == "nldd") {
@@ -460,10 +468,10 @@ relativeChange() const
         }
     }
 
-    resultDelta = gridView.comm().sum(resultDelta);
-    resultDenom = gridView.comm().sum(resultDenom);
+    std::array result{resultDelta, resultDenom};
+    gridView.comm().sum(result.data(), result.size());
 
-    return resultDenom > 0.0 ? resultDelta / resultDenom : 0.0;
+    return result[1] > 0.0 ? result[0] / result[1] : 0.0;
 }
 
 template <class TypeTag>
@@ -553,7 +561,7 @@ updateSolution(const BVector& dx)
     // if the solution is updated, the intensive quantities need to be recalculated
     {
         OPM_TIMEBLOCK(invalidateAndUpdateIntensiveQuantities);
-        simulator_.model().invalidateAndUpdateIntensiveQuantities(/*timeIdx=*/0);
+        simulator_.model().updateChangedIntensiveQuantities();
     }
 
     // Store solution update
@@ -687,11 +695,8 @@ convergenceReduction(Parallel::Communication comm,
         sumBuffer.push_back( pvSum );
         sumBuffer.push_back( numAquiferPvSum );
 
-        // compute global sum
-        comm.sum( sumBuffer.data(), sumBuffer.size() );
-
-        // compute global max
-        comm.max( maxBuffer.data(), maxBuffer.size() );
+        // compute global sum and max in one collective
+        sumMaxReduction(comm, sumBuffer, maxBuffer);
 
         // restore values to local variables
         for (int compIdx = 0, buffIdx = 0; compIdx < numComp; ++compIdx, ++buffIdx) {
@@ -724,18 +729,40 @@ localConvergenceData(std::vector<Scalar>& R_sum,
                      std::vector<int>& maxCoeffCell)
 {
     OPM_TIMEBLOCK(localConvergenceData);
-    Scalar pvSumLocal = 0.0;
-    Scalar numAquiferPvSumLocal = 0.0;
     const auto& model = simulator_.model();
     const auto& problem = simulator_.problem();
 
     const auto& residual = simulator_.model().linearizer().residual();
 
-    ElementContext elemCtx(simulator_);
     const auto& gridView = simulator().gridView();
     IsNumericalAquiferCell isNumericalAquiferCell(gridView.grid());
-    OPM_BEGIN_PARALLEL_TRY_CATCH();
-    for (const auto& elem : elements(gridView, Dune::Partitions::interior)) {
+
+    // Partial results of one thread, merged after the sweep.
+    struct ThreadData
+    {
+        explicit ThreadData(const std::size_t numComp)
+            : R_sum(numComp, Scalar{0})
+            , maxCoeff(numComp, std::numeric_limits<Scalar>::lowest())
+            , B_avg(numComp, Scalar{0})
+            , maxCoeffCell(numComp, -1)
+        {}
+
+        std::vector<Scalar> R_sum;
+        std::vector<Scalar> maxCoeff;
+        std::vector<Scalar> B_avg;
+        std::vector<int> maxCoeffCell;
+        Scalar pvSum{0};
+        Scalar numAquiferPvSum{0};
+        std::vector<std::pair<unsigned, Scalar>> cnvCellPv;
+    };
+
+    const int numThreads = gridIsUnchanging ? ThreadManager::maxThreads() : 1;
+    std::vector<ThreadData> threadData(numThreads, ThreadData(B_avg.size()));
+
+    // Pore volumes of the cells used by characteriseCnvPvSplit() are
+    // recorded here, so that the CNV split does not need another sweep.
+    auto processElement = [&](const auto& elem, ElementContext& elemCtx, ThreadData& data)
+    {
         elemCtx.updatePrimaryStencil(elem);
         elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
 
@@ -745,20 +772,62 @@ localConvergenceData(std::vector<Scalar>& R_sum,
 
         const auto pvValue = problem.referencePorosity(cell_idx, /*timeIdx=*/0) *
                              model.dofTotalVolume(cell_idx);
-        pvSumLocal += pvValue;
+        data.pvSum += pvValue;
 
         if (isNumericalAquiferCell(elem)) {
-            numAquiferPvSumLocal += pvValue;
+            data.numAquiferPvSum += pvValue;
+        }
+        else {
+            data.cnvCellPv.emplace_back(cell_idx, pvValue);
         }
 
         this->getMaxCoeff(cell_idx, intQuants, fs, residual, pvValue,
-                          B_avg, R_sum, maxCoeff, maxCoeffCell);
+                          data.B_avg, data.R_sum, data.maxCoeff, data.maxCoeffCell);
+    };
+
+    OPM_BEGIN_PARALLEL_TRY_CATCH();
+    if constexpr (gridIsUnchanging) {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (const auto& chunk : *element_chunks_) {
+            ElementContext elemCtx(simulator_);
+            auto& data = threadData[ThreadManager::threadId()];
+            for (const auto& elem : chunk) {
+                if (elem.partitionType() == Dune::InteriorEntity) {
+                    processElement(elem, elemCtx, data);
+                }
+            }
+        }
+    }
+    else {
+        ElementContext elemCtx(simulator_);
+        for (const auto& elem : elements(gridView, Dune::Partitions::interior)) {
+            processElement(elem, elemCtx, threadData.front());
+        }
     }
 
     OPM_END_PARALLEL_TRY_CATCH("BlackoilModel::localConvergenceData() failed: ", grid_.comm());
 
-    // compute local average in terms of global number of elements
+    Scalar pvSumLocal = 0.0;
+    Scalar numAquiferPvSumLocal = 0.0;
+    cnvCellPv_.clear();
     const int bSize = B_avg.size();
+    for (const auto& data : threadData) {
+        pvSumLocal += data.pvSum;
+        numAquiferPvSumLocal += data.numAquiferPvSum;
+        cnvCellPv_.insert(cnvCellPv_.end(), data.cnvCellPv.begin(), data.cnvCellPv.end());
+        for (int i = 0; i < bSize; ++i) {
+            B_avg[i] += data.B_avg[i];
+            R_sum[i] += data.R_sum[i];
+            if (data.maxCoeff[i] > maxCoeff[i]) {
+                maxCoeff[i] = data.maxCoeff[i];
+                maxCoeffCell[i] = data.maxCoeffCell[i];
+            }
+        }
+    }
+
+    // compute local average in terms of global number of elements
     for (int i = 0; i < bSize; ++i) {
         B_avg[i] /= Scalar(global_nc_);
     }
@@ -778,12 +847,6 @@ characteriseCnvPvSplit(const std::vector<Scalar>& B_avg, const double dt)
     // 2: tolerance_cnv_relaxed < cnv
     constexpr auto numPvGroups = std::vector<double>::size_type{3};
 
-    auto cnvPvSplit = std::pair<std::vector<double>, std::vector<int>> {
-        std::piecewise_construct,
-        std::forward_as_tuple(numPvGroups),
-        std::forward_as_tuple(numPvGroups)
-    };
-
     auto maxCNV = [&B_avg, dt](const auto& residual, const double pvol)
     {
         return (dt / pvol) *
@@ -796,53 +859,60 @@ characteriseCnvPvSplit(const std::vector<Scalar>& B_avg, const double dt)
                                }, std::multiplies<>{});
     };
 
-    auto& [splitPV, cellCntPV] = cnvPvSplit;
-
-    const auto& model = this->simulator().model();
-    const auto& problem = this->simulator().problem();
-    const auto& residual = model.linearizer().residual();
-    const auto& gridView = this->simulator().gridView();
-
-    const IsNumericalAquiferCell isNumericalAquiferCell(gridView.grid());
+    const auto& residual = this->simulator().model().linearizer().residual();
 
-    ElementContext elemCtx(this->simulator());
+    // For dP and dS check, we need cell indices of [1] violations
+    const bool collectCells = this->param_.tolerance_max_dp_ > 0.0
+        || this->param_.tolerance_max_ds_ > 0.0
+        || this->param_.tolerance_max_drs_ > 0.0
+        || this->param_.tolerance_max_drv_ > 0.0;
 
-    std::vector<unsigned> ixCells;
-
-    OPM_BEGIN_PARALLEL_TRY_CATCH();
-    for (const auto& elem : elements(gridView, Dune::Partitions::interior)) {
-        // Skip cells of numerical Aquifer
-        if (isNumericalAquiferCell(elem)) {
-            continue;
-        }
-
-        elemCtx.updatePrimaryStencil(elem);
-
-        const unsigned cell_idx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-        const auto pvValue = problem.referencePorosity(cell_idx, /*timeIdx=*/0)
-            * model.dofTotalVolume(cell_idx);
+    // Pore volumes of the three groups followed by the cell counts, so
+    // that a single global sum covers both.
+    using SplitBuffer = std::array<double, 2 * numPvGroups>;
+    const int numThreads = ThreadManager::maxThreads();
+    std::vector<SplitBuffer> threadSplit(numThreads, SplitBuffer{});
+    std::vector<std::vector<unsigned>> threadIxCells(numThreads);
 
+    const auto numCells = cnvCellPv_.size();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (std::size_t i = 0; i < numCells; ++i) {
+        const auto [cell_idx, pvValue] = cnvCellPv_[i];
         const auto maxCnv = maxCNV(residual[cell_idx], pvValue);
 
         const auto ix = (maxCnv > this->param_.tolerance_cnv_)
             + (maxCnv > this->param_.tolerance_cnv_relaxed_);
 
-        splitPV[ix] += static_cast<double>(pvValue);
-        ++cellCntPV[ix];
+        auto& split = threadSplit[ThreadManager::threadId()];
+        split[ix] += static_cast<double>(pvValue);
+        split[numPvGroups + ix] += 1.0;
 
-        // For dP and dS check, we need cell indices of [1] violations
-        if ( ix > 0 &&
-             (this->param_.tolerance_max_dp_ > 0.0 || this->param_.tolerance_max_ds_ > 0.0
-              || this->param_.tolerance_max_drs_ > 0.0 || this->param_.tolerance_max_drv_ > 0.0 ) ) {
-            ixCells.push_back(cell_idx);
+        if (ix > 0 && collectCells) {
+            threadIxCells[ThreadManager::threadId()].push_back(cell_idx);
         }
     }
 
-    OPM_END_PARALLEL_TRY_CATCH("BlackoilModel::characteriseCnvPvSplit() failed: ",
-                               this->grid_.comm());
+    SplitBuffer split{};
+    std::vector<unsigned> ixCells;
+    for (int thread = 0; thread < numThreads; ++thread) {
+        std::transform(split.begin(), split.end(), threadSplit[thread].begin(),
+                       split.begin(), std::plus<>{});
+        ixCells.insert(ixCells.end(),
+                       threadIxCells[thread].begin(), threadIxCells[thread].end());
+    }
 
-    this->grid_.comm().sum(splitPV  .data(), splitPV  .size());
-    this->grid_.comm().sum(cellCntPV.data(), cellCntPV.size());
+    this->grid_.comm().sum(split.data(), split.size());
+
+    auto cnvPvSplit = std::pair<std::vector<double>, std::vector<int>> {
+        std::piecewise_construct,
+        std::forward_as_tuple(split.begin(), split.begin() + numPvGroups),
+        std::forward_as_tuple(numPvGroups)
+    };
+    std::transform(split.begin() + numPvGroups, split.end(),
+                   cnvPvSplit.second.begin(),
+                   [](const double count) { return static_cast<int>(count); });
 
     return { cnvPvSplit, ixCells };
 }
@@ -449,11 +449,16 @@ private:
         {
         OPM_TIMEBLOCK(prepareCellBasedData);
         damarisOutputModule_->setupExtractors(isSubStep, reportStepNum);
-        for (const auto& elem : elements(gridView, Dune::Partitions::interior)) {
-            elemCtx.updatePrimaryStencil(elem);
-            elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
+        if (damarisOutputModule_->canProcessCells(num_interior)) {
+            damarisOutputModule_->processCells(num_interior);
+        }
+        else {
+            for (const auto& elem : elements(gridView, Dune::Partitions::interior)) {
+                elemCtx.updatePrimaryStencil(elem);
+                elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
 
-            damarisOutputModule_->processElement(elemCtx);
+                damarisOutputModule_->processElement(elemCtx);
+            }
         }
         damarisOutputModule_->clearExtractors();
         }
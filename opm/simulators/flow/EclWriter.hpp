@@ -814,12 +814,18 @@ private:
 
             this->outputModule_->prepareDensityAccumulation();
             this->outputModule_->setupExtractors(isSubStep, reportStepNum);
-            for (const auto& elem : elements(gridView, Dune::Partitions::interior)) {
-                elemCtx.updatePrimaryStencil(elem);
-                elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
+            if (this->outputModule_->canProcessCells(num_interior)) {
+                this->outputModule_->processCells(num_interior);
+                this->outputModule_->processBlockData(elemCtx);
+            }
+            else {
+                for (const auto& elem : elements(gridView, Dune::Partitions::interior)) {
+                    elemCtx.updatePrimaryStencil(elem);
+                    elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
 
-                this->outputModule_->processElement(elemCtx);
-                this->outputModule_->processElementBlockData(elemCtx);
+                    this->outputModule_->processElement(elemCtx);
+                    this->outputModule_->processElementBlockData(elemCtx);
+                }
             }
             this->outputModule_->clearExtractors();
 
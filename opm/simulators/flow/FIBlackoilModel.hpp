@@ -38,14 +38,26 @@
 #include <opm/grid/utility/ElementChunks.hpp>
 
 #include <opm/models/parallel/threadmanager.hpp>
+#include <opm/models/utils/parametersystem.hpp>
 #include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
 
 #include <opm/material/fluidmatrixinteractions/EclMultiplexerMaterialParams.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <stdexcept>
 #include <type_traits>
 
+namespace Opm::Parameters {
+
+struct IncrementalIntensiveQuantities { static constexpr bool value = false; };
+
+template<class Scalar>
+struct IntensiveQuantitiesChangeTolerance { static constexpr Scalar value = 0.0; };
+
+} // namespace Opm::Parameters
+
 namespace Opm {
 
 template <typename TypeTag>
@@ -54,6 +66,9 @@ class FIBlackOilModel : public BlackOilModel<TypeTag>
     using ParentType = BlackOilModel<TypeTag>;
     using Simulator = GetPropType<TypeTag, Properties::Simulator>;
     using IntensiveQuantities = GetPropType<TypeTag, Properties::IntensiveQuantities>;
+    using PrimaryVariables = GetPropType<TypeTag, Properties::PrimaryVariables>;
+    using SolutionVector = GetPropType<TypeTag, Properties::SolutionVector>;
+    using Scalar = GetPropType<TypeTag, Properties::Scalar>;
     using ElementContext = GetPropType<TypeTag, Properties::ElementContext>;
     using ThreadManager = GetPropType<TypeTag, Properties::ThreadManager>;
     using GridView = GetPropType<TypeTag, Properties::GridView>;
@@ -79,39 +94,87 @@ public:
                           Dune::Partitions::all,
                           ThreadManager::maxThreads())
     {
+        incrementalIntQuants_ = Parameters::Get<Parameters::IncrementalIntensiveQuantities>();
+        intQuantsChangeTolerance_ = Parameters::Get<Parameters::IntensiveQuantitiesChangeTolerance<Scalar>>();
+    }
+
+    /*!
+     * \brief Register all run-time parameters for the model.
+     */
+    static void registerParameters()
+    {
+        ParentType::registerParameters();
+
+        Parameters::Register<Parameters::IncrementalIntensiveQuantities>
+            ("Only recompute the intensive quantities of cells whose primary variables "
+             "have changed after a Newton update. The first update of every time step "
+             "always recomputes all cells.");
+        Parameters::Register<Parameters::IntensiveQuantitiesChangeTolerance<Scalar>>
+            ("Relative change of a primary variable below which the intensive quantities "
+             "of a cell are not recomputed by incremental updates. Changes are measured "
+             "relative to max(|x|, 1).");
     }
 
     void invalidateAndUpdateIntensiveQuantities(unsigned timeIdx) const
     {
         this->invalidateIntensiveQuantitiesCache(timeIdx);
-        if constexpr (gridIsUnchanging) {
-            if constexpr (avoidElementContext) {
-                updateCachedIntQuants(timeIdx);
-                return;
-            }
-            OPM_BEGIN_PARALLEL_TRY_CATCH();
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-            for (const auto& chunk : element_chunks_) {
-                ElementContext elemCtx(this->simulator_);
-                for (const auto& elem : chunk) {
-                    elemCtx.updatePrimaryStencil(elem);
-                    elemCtx.updatePrimaryIntensiveQuantities(timeIdx);
-                }
-            }
-            OPM_END_PARALLEL_TRY_CATCH("invalidateAndUpdateIntensiveQuantities: state error",
-                                       this->simulator_.vanguard().grid().comm());
-        } else {
-            // Grid is possibly refined or otherwise changed between calls.
-            ElementContext elemCtx(this->simulator_);
-            for (const auto& elem : elements(this->gridView_)) {
-                elemCtx.updatePrimaryStencil(elem);
-                elemCtx.updatePrimaryIntensiveQuantities(timeIdx);
-            }
+        updateInvalidIntensiveQuantities_(timeIdx);
+        if (timeIdx == 0 && intQuantsPrimaryVarsValid_) {
+            intQuantsPrimaryVars_ = this->solution(/*timeIdx=*/0);
         }
     }
 
+    /*!
+     * \brief Update the intensive quantities for time index 0 after the solution has
+     *        been changed by a Newton update.
+     *
+     * With incremental updates enabled, only the cells whose primary variables have
+     * changed by more than the tolerance since their intensive quantities were last
+     * computed are updated. The first update after the start of a time step always
+     * recomputes all cells, since the problem may have changed quantities which the
+     * intensive quantities depend upon (hysteresis, rock compaction, DRSDT, ...).
+     */
+    void updateChangedIntensiveQuantities() const
+    {
+        if (!incrementalIntQuants_ || !this->storeIntensiveQuantities()) {
+            invalidateAndUpdateIntensiveQuantities(/*timeIdx=*/0);
+            return;
+        }
+
+        const auto& solution = this->solution(/*timeIdx=*/0);
+        if (!intQuantsPrimaryVarsValid_ || intQuantsPrimaryVars_.size() != solution.size()) {
+            invalidateAndUpdateIntensiveQuantities(/*timeIdx=*/0);
+            intQuantsPrimaryVars_ = solution;
+            intQuantsPrimaryVarsValid_ = true;
+            return;
+        }
+
+        const std::size_t numChanged =
+            this->invalidateIntensiveQuantitiesCache(/*timeIdx=*/0,
+                [this, &solution](const std::size_t globalIdx)
+                {
+                    if (!primaryVarsChanged_(solution[globalIdx], intQuantsPrimaryVars_[globalIdx])) {
+                        return false;
+                    }
+                    intQuantsPrimaryVars_[globalIdx] = solution[globalIdx];
+                    return true;
+                });
+        if (numChanged > 0) {
+            updateInvalidIntensiveQuantities_(/*timeIdx=*/0);
+        }
+    }
+
+    /*!
+     * \brief Called by the update() method before it tries to apply the newton method.
+     *
+     * Makes the next incremental update of the intensive quantities a full one.
+     */
+    void advanceTimeLevel()
+    {
+        ParentType::advanceTimeLevel();
+        intQuantsPrimaryVarsValid_ = false;
+    }
+
     void invalidateAndUpdateIntensiveQuantitiesOverlap(unsigned timeIdx) const
     {
         // loop over all elements
@@ -134,6 +197,7 @@ public:
                 for (unsigned dofIdx = 0; dofIdx < numPrimaryDof; ++dofIdx) {
                     const unsigned globalIndex = elemCtx.globalSpaceIndex(dofIdx, timeIdx);
                     this->setIntensiveQuantitiesCacheEntryValidity(globalIndex, timeIdx, false);
+                    storeIntQuantsPrimaryVars_(globalIndex, timeIdx);
                 }
                 // Update for this element.
                 elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
@@ -166,6 +230,7 @@ public:
                 for (unsigned dofIdx = 0; dofIdx < numPrimaryDof; ++dofIdx) {
                     const unsigned globalIndex = elemCtx.globalSpaceIndex(dofIdx, timeIdx);
                     this->setIntensiveQuantitiesCacheEntryValidity(globalIndex, timeIdx, false);
+                    storeIntQuantsPrimaryVars_(globalIndex, timeIdx);
                 }
                 // Update for this element.
                 elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
@@ -185,6 +250,7 @@ public:
         // update at a physically meaningful solution.
         // this->solution(/*timeIdx=*/0) = this->solution(/*timeIdx=*/1);
         ParentType::updateFailed();
+        intQuantsPrimaryVarsValid_ = false;
         invalidateAndUpdateIntensiveQuantities(/*timeIdx=*/0);
     }
 
@@ -207,6 +273,72 @@ public:
 
 protected:
 
+    // Update the intensive quantities of all cells whose cache entry is invalid.
+    void updateInvalidIntensiveQuantities_(unsigned timeIdx) const
+    {
+        if constexpr (gridIsUnchanging) {
+            if constexpr (avoidElementContext) {
+                updateCachedIntQuants(timeIdx);
+                return;
+            }
+            OPM_BEGIN_PARALLEL_TRY_CATCH();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for (const auto& chunk : element_chunks_) {
+                ElementContext elemCtx(this->simulator_);
+                for (const auto& elem : chunk) {
+                    elemCtx.updatePrimaryStencil(elem);
+                    elemCtx.updatePrimaryIntensiveQuantities(timeIdx);
+                }
+            }
+            OPM_END_PARALLEL_TRY_CATCH("invalidateAndUpdateIntensiveQuantities: state error",
+                                       this->simulator_.vanguard().grid().comm());
+        } else {
+            // Grid is possibly refined or otherwise changed between calls.
+            ElementContext elemCtx(this->simulator_);
+            for (const auto& elem : elements(this->gridView_)) {
+                elemCtx.updatePrimaryStencil(elem);
+                elemCtx.updatePrimaryIntensiveQuantities(timeIdx);
+            }
+        }
+    }
+
+    // Returns true if the intensive quantities computed from oldPv are not
+    // accurate enough for newPv.
+    bool primaryVarsChanged_(const PrimaryVariables& newPv, const PrimaryVariables& oldPv) const
+    {
+        if (intQuantsChangeTolerance_ <= 0.0) {
+            return !(newPv == oldPv);
+        }
+
+        // a variable switch always requires an update
+        if (newPv.primaryVarsMeaningWater() != oldPv.primaryVarsMeaningWater() ||
+            newPv.primaryVarsMeaningPressure() != oldPv.primaryVarsMeaningPressure() ||
+            newPv.primaryVarsMeaningGas() != oldPv.primaryVarsMeaningGas() ||
+            newPv.primaryVarsMeaningBrine() != oldPv.primaryVarsMeaningBrine() ||
+            newPv.primaryVarsMeaningSolvent() != oldPv.primaryVarsMeaningSolvent())
+        {
+            return true;
+        }
+        for (unsigned eqIdx = 0; eqIdx < numEq; ++eqIdx) {
+            const Scalar scale = std::max(std::abs(oldPv[eqIdx]), Scalar{1.0});
+            if (std::abs(newPv[eqIdx] - oldPv[eqIdx]) > intQuantsChangeTolerance_ * scale) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Keep the reference primary variables of incremental updates in sync
+    // with cells whose intensive quantities are recomputed.
+    void storeIntQuantsPrimaryVars_(unsigned globalIdx, unsigned timeIdx) const
+    {
+        if (timeIdx == 0 && intQuantsPrimaryVarsValid_) {
+            intQuantsPrimaryVars_[globalIdx] = this->solution(/*timeIdx=*/0)[globalIdx];
+        }
+    }
+
     template <EclMultiplexerApproach ApproachArg>
     using EMD = EclMultiplexerDispatch<ApproachArg>;
 
@@ -259,7 +391,10 @@ protected:
 #endif
         for (const auto& chunk : element_chunks_) {
             for (const auto& elem : chunk) {
-                this->template updateSingleCachedIntQuantUnchecked<Args...>(elementMapper.index(elem), timeIdx);
+                const unsigned globalIdx = elementMapper.index(elem);
+                if (!this->intensiveQuantityCacheUpToDate_[timeIdx][globalIdx]) {
+                    this->template updateSingleCachedIntQuantUnchecked<Args...>(globalIdx, timeIdx);
+                }
             }
         }
     }
@@ -276,6 +411,13 @@ protected:
     }
 
     ElementChunks<GridView, Dune::Partitions::All> element_chunks_;
+
+    // Primary variables from which the cached intensive quantities for time
+    // index 0 were computed, used by incremental updates.
+    mutable SolutionVector intQuantsPrimaryVars_;
+    mutable bool intQuantsPrimaryVarsValid_ = false;
+    bool incrementalIntQuants_ = false;
+    Scalar intQuantsChangeTolerance_ = 0.0;
 };
 
 } // namespace Opm
@@ -220,7 +220,8 @@ void FlowGenericVanguard::readDeck(const std::string& filename)
                   modelParams_.actionState_,
                   modelParams_.wtestState_,
                   modelParams_.eclSummaryConfig_,
-                  nullptr, "normal", "normal", "100", false, false, false, {}, /*slaveMode=*/false);
+                  nullptr, "normal", "normal", "100", false, false, false, {}, /*slaveMode=*/false,
+                  /*deckCacheFile=*/"", /*moduleVersion=*/"");
     modelParams_.setupTime_ = setupTimer.stop();
 }
 
@@ -477,6 +478,12 @@ void FlowGenericVanguard::registerParameters_()
          "100 (skip SKIP100..ENDSKIP, keep SKIP300..ENDSKIP) [default], "
          "300 (skip SKIP300..ENDSKIP, keep SKIP100..ENDSKIP) and "
          "all (skip both SKIP100..ENDSKIP and SKIP300..ENDSKIP) ");
+    Parameters::Register<Parameters::DeckCache>
+        ("Name of a binary cache file for the state objects created from the deck. "
+         "The file is written if it does not exist or does not match the deck "
+         "and is loaded instead of processing the schedule on later runs. "
+         "The cache is rebuilt if the deck or any included file changes. "
+         "Restarted runs are not cached.");
     Parameters::Register<Parameters::SchedRestart>
         ("When restarting: should we try to initialize wells and "
          "groups from historical SCHEDULE section.");
@@ -50,6 +50,7 @@ namespace Opm::Parameters {
 struct AllowDistributedWells { static constexpr bool value = false; };
 struct AllowSplittingInactiveWells { static constexpr bool value = true; };
 
+struct DeckCache { static constexpr auto value = ""; };
 struct EclOutputInterval { static constexpr int value = -1; };
 struct EdgeWeightsMethod  { static constexpr auto value = "transmissibility"; };
 struct EnableDryRun { static constexpr auto value = "auto"; };
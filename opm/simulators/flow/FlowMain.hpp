@@ -33,6 +33,7 @@
 #include <opm/simulators/flow/NlddReporting.hpp>
 #include <opm/simulators/flow/SimulatorFullyImplicitBlackoil.hpp>
 #include <opm/simulators/flow/rescoup/ReservoirCouplingEnabled.hpp>
+#include <opm/simulators/utils/TimeBlockReport.hpp>
 
 #if HAVE_DUNE_FEM
 #include <dune/fem/misc/mpimanager.hh>
@@ -405,6 +406,11 @@ namespace Opm {
                                      FlowGenericVanguard::comm());
             }
 
+            // Collective, so must be done before non-output ranks return.
+            writeTimeBlockReport(FlowGenericVanguard::comm(),
+                                 eclState().getIOConfig().getOutputDir(),
+                                 eclState().getIOConfig().getBaseName());
+
             if (! this->output_cout_) {
                 return;
             }
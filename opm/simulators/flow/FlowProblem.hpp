@@ -249,6 +249,7 @@ public:
             this->enableDriftCompensationTemp_ = Parameters::Get<Parameters::EnableDriftCompensationTemp>();
         }
 
+        transmissibilities_.setCompactStorage(Parameters::Get<Parameters::CompactTransmissibilityStorage>());
     }
 
     virtual ~FlowProblem() = default;
@@ -548,6 +549,32 @@ public:
         return transmissibilities_.transmissibility(globalCenterElemIdx, globalElemIdx);
     }
 
+    /*!
+     * \brief Position of the transmissibility between two elements for
+     *        transmissibilityAt(), or -1 if there is none.
+     */
+    std::ptrdiff_t transmissibilityIndex(unsigned globalCenterElemIdx, unsigned globalElemIdx) const
+    {
+        return transmissibilities_.compactIndex(globalCenterElemIdx, globalElemIdx);
+    }
+
+    /*!
+     * \brief Transmissibility at a position given by transmissibilityIndex().
+     */
+    Scalar transmissibilityAt(std::ptrdiff_t transIdx) const
+    {
+        return transmissibilities_.transmissibilityAt(transIdx);
+    }
+
+    /*!
+     * \brief Changes whenever the positions given by transmissibilityIndex() are
+     *        invalidated.
+     */
+    std::size_t transmissibilityLayoutVersion() const
+    {
+        return transmissibilities_.compactLayoutVersion();
+    }
+
     /*!
      * \copydoc EclTransmissiblity::diffusivity
      */
@@ -1054,6 +1081,9 @@ public:
             assert(isfinite(rate[eqIdx]));
         }
 
+        // Add aquifer contributions, which are given per unit volume.
+        aquiferModel_.addToSource(rate, globalDofIdx, timeIdx);
+
         // Add non-well sources.
         addToSourceDense(rate, globalDofIdx, timeIdx);
     }
@@ -637,8 +637,6 @@ public:
                           unsigned globalDofIdx,
                           unsigned timeIdx) const override
     {
-        this->aquiferModel_.addToSource(rate, globalDofIdx, timeIdx);
-
         // Add source term from deck
         const auto& source = this->simulator().vanguard().schedule()[this->episodeIndex()].source();
         std::array<int,3> ijk;
@@ -44,6 +44,7 @@
 #include <algorithm>
 #include <functional>
 #include <set>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -86,6 +87,7 @@ class FlowProblemComp : public FlowProblem<TypeTag>
     using typename FlowProblemType::RateVector;
 
     using InitialFluidState = CompositionalFluidState<Scalar, FluidSystem>;
+    using BoundaryFluidState = typename GetPropType<TypeTag, Properties::IntensiveQuantities>::ScalarFluidState;
     using EclWriterType = EclWriter<TypeTag, OutputCompositionalModule<TypeTag> >;
 
 public:
@@ -418,6 +420,23 @@ public:
         return thresholdPressures_;
     }
 
+    /*!
+     * \copydoc BlackOilBaseProblem::thresholdPressure
+     */
+    Scalar thresholdPressure(unsigned elem1Idx, unsigned elem2Idx) const
+    { return thresholdPressures_.thresholdPressure(elem1Idx, elem2Idx); }
+
+    //! The flux computation of the compositional model does not use module parameters.
+    struct ModuleParams {};
+
+    const ModuleParams& moduleParams() const
+    { return moduleParams_; }
+
+    BoundaryFluidState boundaryFluidState(unsigned /* globalDofIdx */, const int /* directionId */) const
+    {
+        throw std::logic_error("boundary condition is not supported by compostional modeling yet");
+    }
+
     const EclWriterType& eclWriter() const
     { return *eclWriter_; }
 
@@ -624,6 +643,7 @@ private:
     }
 
     FlowThresholdPressure<TypeTag> thresholdPressures_;
+    ModuleParams moduleParams_{};
 
     std::vector<InitialFluidState> initialFluidStates_;
 
@@ -80,6 +80,9 @@ void registerFlowProblemParameters()
     Parameters::Register<Parameters::ConserveInnerEnergyThermal>
         ("Conserve inner energy and not enthalpy "
          "even if THERMAL is used.");
+    Parameters::Register<Parameters::CompactTransmissibilityStorage>
+        ("Store transmissibilities in arrays following the cell-neighbour "
+         "structure of the grid instead of hash maps. Uses less memory for large grids");
 
     // By default, stop it after the universe will probably have stopped
     // to exist. (the ECL problem will finish the simulation explicitly
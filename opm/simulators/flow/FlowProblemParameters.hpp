@@ -69,6 +69,10 @@ struct UseHybridNewton { static constexpr bool value = false; };
 // Conserve inner energy instead of enthalpy even if THERMAL is used
 struct ConserveInnerEnergyThermal { static constexpr bool value = false; };
 
+// Store transmissibilities in arrays following the cell-neighbour structure
+// of the grid instead of hash maps
+struct CompactTransmissibilityStorage { static constexpr bool value = false; };
+
 } // namespace Opm::Parameters
 
 namespace Opm {
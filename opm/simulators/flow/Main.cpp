@@ -291,6 +291,7 @@ void Main::readDeck(const std::string& deckFilename,
                     const std::size_t numThreads,
                     const int output_param,
                     const bool slaveMode,
+                    const std::string& deckCacheFile,
                     const std::string& parameters,
                     std::string_view moduleVersion,
                     std::string_view compileTimestamp)
@@ -327,7 +328,9 @@ void Main::readDeck(const std::string& deckFilename,
                   outputCout_,
                   keepKeywords,
                   outputInterval,
-                  slaveMode);
+                  slaveMode,
+                  deckCacheFile,
+                  moduleVersion);
 
     verifyValidCellGeometry(FlowGenericVanguard::comm(), *this->eclipseState_);
 
@@ -314,6 +314,7 @@ protected:
                            getNumThreads(),
                            Parameters::Get<Parameters::EclOutputInterval>(),
                            Parameters::Get<Parameters::Slave>(),
+                           Parameters::Get<Parameters::DeckCache>(),
                            cmdline_params,
                            Opm::moduleVersion(),
                            Opm::compileTimestamp());
@@ -532,6 +533,7 @@ private:
                   const std::size_t numThreads,
                   const int output_param,
                   const bool slaveMode,
+                  const std::string& deckCacheFile,
                   const std::string& parameters,
                   std::string_view moduleVersion,
                   std::string_view compileTimestamp);
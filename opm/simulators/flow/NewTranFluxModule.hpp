@@ -51,6 +51,7 @@
 #include <opm/common/utility/gpuDecorators.hpp>
 
 #include <array>
+#include <type_traits>
 
 namespace Opm {
 
@@ -310,12 +311,12 @@ public:
         }
     }
 
-    template<class EvalType>
+    template<class EvalType, class IntensiveQuantitiesT>
     OPM_HOST_DEVICE static void calculatePhasePressureDiff_(short& upIdx,
                                             short& dnIdx,
                                             EvalType& pressureDifference,
-                                            const IntensiveQuantities& intQuantsIn,
-                                            const IntensiveQuantities& intQuantsEx,
+                                            const IntensiveQuantitiesT& intQuantsIn,
+                                            const IntensiveQuantitiesT& intQuantsEx,
                                             const unsigned phaseIdx,
                                             const unsigned interiorDofIdx,
                                             const unsigned exteriorDofIdx,
@@ -345,7 +346,9 @@ public:
         Scalar rhoEx = Toolbox::value(intQuantsEx.fluidState().density(phaseIdx));
         Evaluation rhoAvg = (rhoIn + rhoEx)/2;
 
-        if constexpr(enableConvectiveMixing) {
+        // views of the intensive quantities are only used if convective mixing is inactive
+        if constexpr(enableConvectiveMixing &&
+                     std::is_convertible_v<const IntensiveQuantitiesT&, const IntensiveQuantities&>) {
             ConvectiveMixingModule::modifyAvgDensity(rhoAvg, intQuantsIn, intQuantsEx, phaseIdx, moduleParams.convectiveMixingModuleParam);
         }
 
@@ -22,6 +22,10 @@
 
 #include <cassert>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace Opm {
 
 /// \brief Context for iteration-dependent decisions in the Newton solver.
@@ -148,6 +152,10 @@ private:
 /// RAII guard for NLDD domain-local iteration context.
 /// Saves the current context on the problem, installs a local-solve
 /// context, and restores the original on destruction.
+///
+/// Inside an OpenMP parallel region, i.e. when domains are solved
+/// concurrently, the local-solve context is installed for the calling
+/// thread only and the shared context on the problem is left untouched.
 template<class Problem>
 class LocalContextGuard {
 public:
@@ -155,11 +163,24 @@ public:
         : problem_(problem)
         , saved_(problem.iterationContext())
     {
+#ifdef _OPENMP
+        if (omp_in_parallel()) {
+            threadContext_ = saved_.forLocalSolve();
+            previousThreadContext_ = Problem::threadIterationContext();
+            Problem::threadIterationContext() = &threadContext_;
+            threadLocal_ = true;
+            return;
+        }
+#endif
         problem_.mutableIterationContext() = saved_.forLocalSolve();
     }
 
     ~LocalContextGuard()
     {
+        if (threadLocal_) {
+            Problem::threadIterationContext() = previousThreadContext_;
+            return;
+        }
         problem_.mutableIterationContext() = saved_;
     }
 
@@ -174,6 +195,9 @@ public:
 private:
     Problem& problem_;
     NewtonIterationContext saved_;
+    NewtonIterationContext threadContext_{};
+    NewtonIterationContext* previousThreadContext_{nullptr};
+    bool threadLocal_{false};
 };
 
 } // namespace Opm
@@ -45,6 +45,7 @@
 
 #include <opm/models/blackoil/blackoilenergymodules.hh>
 #include <opm/models/blackoil/blackoilproperties.hh>
+#include <opm/models/discretization/common/fvbaseparameters.hh>
 #include <opm/models/discretization/common/fvbaseproperties.hh>
 #include <opm/models/utils/parametersystem.hpp>
 #include <opm/models/utils/propertysystem.hh>
@@ -63,10 +64,12 @@
 #include <cassert>
 #include <cstddef>
 #include <functional>
+#include <iterator>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <variant>
 #include <vector>
 
 namespace Opm {
@@ -285,6 +288,140 @@ public:
         }
     }
 
+    //! \brief Returns true if the element data of the interior cells
+    //!        [0, numCells) can be extracted directly from the intensive
+    //!        quantity cache of the model, see processCells().
+    //! \details Otherwise the caller has to use processElement() with an
+    //!          element context, which computes the intensive quantities.
+    bool canProcessCells(const unsigned numCells) const
+    {
+        if (!std::is_same_v<Discretization, EcfvDiscretization<TypeTag>> ||
+            !Parameters::Get<Parameters::EnableIntensiveQuantityCache>())
+        {
+            return false;
+        }
+
+        // The cache may not be up to date, e.g. right after a restart.
+        const auto& model = simulator_.model();
+        for (unsigned dofIdx = 0; dofIdx < numCells; ++dofIdx) {
+            if (model.cachedIntensiveQuantities(dofIdx, /*timeIdx=*/0) == nullptr) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /*!
+     * \brief Modify the internal buffers according to the cached intensive
+     *        quantities of the interior cells [0, numCells)
+     *
+     * Requires canProcessCells(numCells) to be true.
+     *
+     * Equivalent to calling processElement() for each interior element, but
+     * without an element context. Extractors writing to cell buffers are
+     * run in parallel, extractors doing their own assignments are run
+     * serially afterwards as they may write to shared containers.
+     */
+    void processCells(const unsigned numCells)
+    {
+        OPM_TIMEBLOCK_LOCAL(processCells, Subsystem::Output);
+
+        if (this->extractors_.empty()) {
+            assert(0);
+        }
+
+        std::vector<typename Extractor::Entry> cellExtractors;
+        std::vector<typename Extractor::Entry> assignExtractors;
+        std::ranges::partition_copy(this->extractors_,
+                                    std::back_inserter(cellExtractors),
+                                    std::back_inserter(assignExtractors),
+                                    [](const auto& entry)
+                                    {
+                                        return !std::holds_alternative<typename Extractor::AssignFunc>(entry.data);
+                                    });
+
+        const auto& model = simulator_.model();
+        const auto& matLawManager = simulator_.problem().materialLawManager();
+        const int episodeIdx = simulator_.episodeIndex();
+
+        auto processCell = [&](const unsigned globalDofIdx,
+                               const std::vector<typename Extractor::Entry>& extractors)
+        {
+            const auto* intQuantsPtr = model.cachedIntensiveQuantities(globalDofIdx, /*timeIdx=*/0);
+            // Checked by canProcessCells(), which callers must use to choose this path.
+            assert(intQuantsPtr != nullptr);
+            const auto& intQuants = *intQuantsPtr;
+
+            typename Extractor::HysteresisParams hysterParams;
+            const typename Extractor::Context ectx{
+                globalDofIdx,
+                model.solution(/*timeIdx=*/0)[globalDofIdx].pvtRegionIndex(),
+                episodeIdx,
+                intQuants.fluidState(),
+                intQuants,
+                hysterParams
+            };
+
+            if (matLawManager->enableHysteresis()) {
+                if (FluidSystem::phaseIsActive(oilPhaseIdx) && FluidSystem::phaseIsActive(waterPhaseIdx)) {
+                    matLawManager->oilWaterHysteresisParams(hysterParams.somax,
+                                                            hysterParams.swmax,
+                                                            hysterParams.swmin,
+                                                            globalDofIdx);
+                }
+                if (FluidSystem::phaseIsActive(oilPhaseIdx) && FluidSystem::phaseIsActive(gasPhaseIdx)) {
+                    matLawManager->gasOilHysteresisParams(hysterParams.sgmax,
+                                                          hysterParams.shmax,
+                                                          hysterParams.somin,
+                                                          globalDofIdx);
+                }
+            }
+
+            Extractor::process(ectx, extractors);
+        };
+
+        if (!cellExtractors.empty()) {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for (unsigned dofIdx = 0; dofIdx < numCells; ++dofIdx) {
+                processCell(dofIdx, cellExtractors);
+            }
+        }
+
+        if (!assignExtractors.empty()) {
+            for (unsigned dofIdx = 0; dofIdx < numCells; ++dofIdx) {
+                processCell(dofIdx, assignExtractors);
+            }
+        }
+    }
+
+    //! \brief Process the block data extractors for all interior elements
+    //!        holding a cell with block data.
+    //! \details Other elements are skipped without updating the element context.
+    void processBlockData(ElementContext& elemCtx)
+    {
+        OPM_TIMEBLOCK_LOCAL(processBlockData, Subsystem::Output);
+        if (this->blockExtractors_.empty() && this->extraBlockExtractors_.empty()) {
+            return;
+        }
+
+        const auto& vanguard = simulator_.vanguard();
+        const auto& elemMapper = simulator_.model().elementMapper();
+        for (const auto& elem : elements(simulator_.gridView(), Dune::Partitions::interior)) {
+            const auto cartesianIdx = vanguard.cartesianIndex(elemMapper.index(elem));
+            if (!this->blockExtractors_.contains(cartesianIdx) &&
+                !this->extraBlockExtractors_.contains(cartesianIdx))
+            {
+                continue;
+            }
+
+            elemCtx.updatePrimaryStencil(elem);
+            elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
+            this->processElementBlockData(elemCtx);
+        }
+    }
+
     void processElementBlockData(const ElementContext& elemCtx)
     {
         OPM_TIMEBLOCK_LOCAL(processElementBlockData, Subsystem::Output);
@@ -1250,6 +1387,9 @@ private:
                                            );
                                 } catch (const NumericalProblem&) {
                                     const auto cartesianIdx = vanguard.cartesianIndex(ectx.globalDofIdx);
+#ifdef _OPENMP
+#pragma omp critical
+#endif
                                     failedCells.push_back(cartesianIdx);
                                     return Scalar{0};
                                 }
@@ -1267,6 +1407,9 @@ private:
                                       );
                                   } catch (const NumericalProblem&) {
                                       const auto cartesianIdx =  vanguard.cartesianIndex(ectx.globalDofIdx);
+#ifdef _OPENMP
+#pragma omp critical
+#endif
                                       failedCells.push_back(cartesianIdx);
                                       return Scalar{0};
                                   }
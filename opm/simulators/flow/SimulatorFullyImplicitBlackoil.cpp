@@ -65,6 +65,10 @@ void registerSimulatorParameters()
     Parameters::Register<Parameters::Slave>
         ("Specify if the simulation is a slave simulation in a master-slave simulation");
     Parameters::Hide<Parameters::Slave>();
+    Parameters::Register<Parameters::EnableTimeBlockProfiling>
+        ("Accumulate the time spent in the instrumented blocks of the simulator "
+         "and write a breakdown to CASENAME.TIMEBLOCKS.csv and "
+         "CASENAME.TIMEBLOCKS.json at the end of the run.");
 
 }
 
@@ -67,6 +67,7 @@ struct SaveFile { static constexpr auto* value = ""; };
 struct LoadFile { static constexpr auto* value = ""; };
 struct LoadStep { static constexpr int value = -1; };
 struct Slave { static constexpr bool value = false; };
+struct EnableTimeBlockProfiling { static constexpr bool value = false; };
 
 } // namespace Opm::Parameters
 
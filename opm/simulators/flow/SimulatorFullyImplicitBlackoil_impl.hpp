@@ -34,6 +34,8 @@
 
 #include <opm/simulators/linalg/TPSALinearSolverParameters.hpp>
 
+#include <opm/simulators/utils/TimeBlockProfiler.hpp>
+
 #include <fmt/format.h>
 
 #include <filesystem>
@@ -53,6 +55,8 @@ SimulatorFullyImplicitBlackoil(Simulator& simulator)
                   Parameters::Get<Parameters::SaveFile>(),
                   Parameters::Get<Parameters::LoadFile>())
 {
+    TimeBlockProfiler::enable(Parameters::Get<Parameters::EnableTimeBlockProfiling>());
+
     // Only rank 0 does print to std::cout, and only if specifically requested.
     this->terminalOutput_ = false;
     if (this->grid().comm().rank() == 0) {
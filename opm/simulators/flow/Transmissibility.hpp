@@ -36,6 +36,7 @@
 
 
 #include <array>
+#include <cstddef>
 #include <functional>
 #include <map>
 #include <cstdint>
@@ -158,6 +159,41 @@ public:
     void update(bool global, TransUpdateQuantities update_quantities = TransUpdateQuantities::All,
                 const std::function<unsigned int(unsigned int)>& map = {}, bool applyNncMultRegT = false);
 
+    /*!
+     * \brief Select compact storage of the computed quantities.
+     *
+     * With compact storage, the quantities are moved from the hash maps used while
+     * computing them into arrays laid out like the cell-neighbour (CSR) structure of
+     * the grid at the end of each update(). This takes much less memory for large
+     * grids, and a lookup is a short search within the neighbours of a cell instead
+     * of a hash probe. The lookup functions behave the same for both storages.
+     */
+    void setCompactStorage(bool compact);
+
+    /*!
+     * \brief Return the position of the intersection between two elements in the
+     *        compact storage, or -1 if compact storage is not used.
+     *
+     * Callers which look up the same intersections repeatedly can keep the
+     * positions and use transmissibilityAt() instead of searching every time. The
+     * positions remain valid as long as compactLayoutVersion() does not change.
+     */
+    std::ptrdiff_t compactIndex(unsigned elemIdx1, unsigned elemIdx2) const
+    { return compactIndex_(elemIdx1, elemIdx2); }
+
+    /*!
+     * \brief Return the transmissibility at a position given by compactIndex().
+     */
+    Scalar transmissibilityAt(std::ptrdiff_t compactIdx) const
+    { return compactValue_(compactTrans_, compactIdx); }
+
+    /*!
+     * \brief Return a counter which changes whenever the positions given by
+     *        compactIndex() are invalidated.
+     */
+    std::size_t compactLayoutVersion() const
+    { return compactLayoutVersion_; }
+
 protected:
     void updateFromEclState_(bool global);
 
@@ -276,6 +312,21 @@ protected:
                           const FaceInfo& face,
                           const std::vector<double>& ntg);
 
+    /// \brief Move the contents of the hash maps to the compact storage.
+    void compactStorage_();
+
+    /// \brief Move the contents of the compact storage back to the hash maps.
+    void expandStorage_();
+
+    /// \brief Position of the pair of elements in the compact storage, or -1.
+    std::ptrdiff_t compactIndex_(unsigned elemIdx1, unsigned elemIdx2) const;
+
+    /// \brief Position of the boundary face of an element in the compact storage, or -1.
+    std::ptrdiff_t compactBoundaryIndex_(unsigned elemIdx, unsigned boundaryFaceIdx) const;
+
+    /// \brief Value at a position of the compact storage, throwing if there is none.
+    static Scalar compactValue_(const std::vector<Scalar>& values, std::ptrdiff_t idx);
+
     std::vector<DimMatrix> permeability_;
     std::vector<Scalar> porosity_;
     std::vector<Scalar> dispersion_;
@@ -297,6 +348,28 @@ protected:
     std::unordered_map<std::uint64_t, Scalar> diffusivity_;
     std::unordered_map<std::uint64_t, Scalar> dispersivity_;
 
+    // Compact storage, see setCompactStorage(). Row i holds the sorted neighbours
+    // of element i, and the values are stored for both directions of a pair (for
+    // thermalHalfTrans the one of the row element). Pairs lacking a value of some
+    // quantity hold NaN, and a quantity that is not computed has no values.
+    bool useCompactStorage_ = false;
+    std::vector<std::size_t> compactRowStart_;
+    std::vector<std::uint32_t> compactNeighbor_;
+    std::vector<Scalar> compactTrans_;
+    std::vector<Scalar> compactThermalHalfTrans_;
+    std::vector<Scalar> compactDiffusivity_;
+    std::vector<Scalar> compactDispersivity_;
+    // Likewise for the boundary faces, row i holding those of element i.
+    std::vector<std::size_t> compactBoundaryRowStart_;
+    std::vector<std::uint32_t> compactBoundaryFace_;
+    std::vector<Scalar> compactTransBoundary_;
+    std::vector<Scalar> compactThermalHalfTransBoundary_;
+    // The layout of the previous compact storage while the maps are in use, to
+    // tell whether the next compaction changes the positions of the pairs.
+    std::vector<std::size_t> previousCompactRowStart_;
+    std::vector<std::uint32_t> previousCompactNeighbor_;
+    std::size_t compactLayoutVersion_ = 0;
+
     const LookUpData<Grid,GridView> lookUpData_;
     const LookUpCartesianData<Grid,GridView> lookUpCartesianData_;
 };
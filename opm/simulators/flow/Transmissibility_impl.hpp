@@ -53,6 +53,8 @@
 #include <cstdint>
 #include <functional>
 #include <initializer_list>
+#include <limits>
+#include <numeric>
 #include <sstream>
 #include <stdexcept>
 #include <type_traits>
@@ -90,6 +92,20 @@ namespace details {
     {
         return (std::uint64_t(elemIdx1) << elemIdxShift) + elemIdx2;
     }
+
+    // The elements of a pair id made by directionalIsId(), in order.
+    inline std::pair<std::uint32_t, std::uint32_t> directionalIsIdReverse(const std::uint64_t id)
+    {
+        return std::make_pair(static_cast<std::uint32_t>(id >> elemIdxShift),
+                              static_cast<std::uint32_t>(id));
+    }
+
+    // Free the memory held by a container.
+    template<class Container>
+    void releaseStorage(Container& container)
+    {
+        Container().swap(container);
+    }
 }
 
 template<class Grid, class GridView, class ElementMapper, class CartesianIndexMapper, class Scalar>
@@ -121,6 +137,9 @@ template<class Grid, class GridView, class ElementMapper, class CartesianIndexMa
 Scalar Transmissibility<Grid,GridView,ElementMapper,CartesianIndexMapper,Scalar>::
 transmissibility(unsigned elemIdx1, unsigned elemIdx2) const
 {
+    if (!compactRowStart_.empty()) {
+        return compactValue_(compactTrans_, compactIndex_(elemIdx1, elemIdx2));
+    }
     return trans_.at(details::isId(elemIdx1, elemIdx2));
 }
 
@@ -128,6 +147,9 @@ template<class Grid, class GridView, class ElementMapper, class CartesianIndexMa
 Scalar Transmissibility<Grid,GridView,ElementMapper,CartesianIndexMapper,Scalar>::
 transmissibilityBoundary(unsigned elemIdx, unsigned boundaryFaceIdx) const
 {
+    if (!compactRowStart_.empty()) {
+        return compactValue_(compactTransBoundary_, compactBoundaryIndex_(elemIdx, boundaryFaceIdx));
+    }
     return transBoundary_.at(std::make_pair(elemIdx, boundaryFaceIdx));
 }
 
@@ -135,6 +157,9 @@ template<class Grid, class GridView, class ElementMapper, class CartesianIndexMa
 Scalar Transmissibility<Grid,GridView,ElementMapper,CartesianIndexMapper,Scalar>::
 thermalHalfTrans(unsigned insideElemIdx, unsigned outsideElemIdx) const
 {
+    if (!compactRowStart_.empty()) {
+        return compactValue_(compactThermalHalfTrans_, compactIndex_(insideElemIdx, outsideElemIdx));
+    }
     return thermalHalfTrans_.at(details::directionalIsId(insideElemIdx, outsideElemIdx));
 }
 
@@ -142,6 +167,10 @@ template<class Grid, class GridView, class ElementMapper, class CartesianIndexMa
 Scalar Transmissibility<Grid,GridView,ElementMapper,CartesianIndexMapper,Scalar>::
 thermalHalfTransBoundary(unsigned insideElemIdx, unsigned boundaryFaceIdx) const
 {
+    if (!compactRowStart_.empty()) {
+        return compactValue_(compactThermalHalfTransBoundary_,
+                             compactBoundaryIndex_(insideElemIdx, boundaryFaceIdx));
+    }
     return thermalHalfTransBoundary_.at(std::make_pair(insideElemIdx, boundaryFaceIdx));
 }
 
@@ -149,6 +178,12 @@ template<class Grid, class GridView, class ElementMapper, class CartesianIndexMa
 Scalar Transmissibility<Grid,GridView,ElementMapper,CartesianIndexMapper,Scalar>::
 diffusivity(unsigned elemIdx1, unsigned elemIdx2) const
 {
+    if (!compactRowStart_.empty()) {
+        return compactDiffusivity_.empty()
+            ? 0.0
+            : compactValue_(compactDiffusivity_, compactIndex_(elemIdx1, elemIdx2));
+    }
+
     if (diffusivity_.empty())
         return 0.0;
 
@@ -159,6 +194,12 @@ template<class Grid, class GridView, class ElementMapper, class CartesianIndexMa
 Scalar Transmissibility<Grid,GridView,ElementMapper,CartesianIndexMapper,Scalar>::
 dispersivity(unsigned elemIdx1, unsigned elemIdx2) const
 {
+    if (!compactRowStart_.empty()) {
+        return compactDispersivity_.empty()
+            ? 0.0
+            : compactValue_(compactDispersivity_, compactIndex_(elemIdx1, elemIdx2));
+    }
+
     if (dispersivity_.empty())
         return 0.0;
 
@@ -194,6 +235,11 @@ update(bool global, const TransUpdateQuantities update_quantities,
 
     const int num_threads = ThreadManager::maxThreads();
 
+    // The quantities are computed in the hash maps, including those not updated here.
+    if (!compactRowStart_.empty()) {
+        this->expandStorage_();
+    }
+
     // reserving some space in the hashmap upfront saves quite a bit of time because
     // resizes are costly for hashmaps and there would be quite a few of them if we
     // would not have a rough idea of how large the final map will be (the rough idea
@@ -586,6 +632,211 @@ update(bool global, const TransUpdateQuantities update_quantities,
     // If disableNNC == true, remove all non-neighbouring transmissibilities.
     // If disableNNC == false, remove very small non-neighbouring transmissibilities.
     this->removeNonCartesianTransmissibilities_(disableNNC);
+
+    if (useCompactStorage_) {
+        this->compactStorage_();
+    }
+}
+
+template<class Grid, class GridView, class ElementMapper, class CartesianIndexMapper, class Scalar>
+void Transmissibility<Grid,GridView,ElementMapper,CartesianIndexMapper,Scalar>::
+setCompactStorage(const bool compact)
+{
+    useCompactStorage_ = compact;
+    const bool isCompact = !compactRowStart_.empty();
+    if (compact && !isCompact && !trans_.empty()) {
+        this->compactStorage_();
+    }
+    else if (!compact && isCompact) {
+        this->expandStorage_();
+        details::releaseStorage(previousCompactRowStart_);
+        details::releaseStorage(previousCompactNeighbor_);
+        ++compactLayoutVersion_;
+    }
+}
+
+template<class Grid, class GridView, class ElementMapper, class CartesianIndexMapper, class Scalar>
+void Transmissibility<Grid,GridView,ElementMapper,CartesianIndexMapper,Scalar>::
+compactStorage_()
+{
+    const auto numElem = static_cast<std::size_t>(gridView_.size(/*codim=*/0));
+    const Scalar none = std::numeric_limits<Scalar>::quiet_NaN();
+    const auto undirected = [](const std::uint64_t id) { return details::isIdReverse(id); };
+    const auto directed = [](const std::uint64_t id) { return details::directionalIsIdReverse(id); };
+
+    // Both directions of every pair of elements having some value.
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> pairs;
+    pairs.reserve(2 * trans_.size());
+    const auto addPairs = [&pairs](const auto& map, const auto& reverse)
+    {
+        for (const auto& entry : map) {
+            const auto [elemIdx1, elemIdx2] = reverse(entry.first);
+            pairs.emplace_back(elemIdx1, elemIdx2);
+            pairs.emplace_back(elemIdx2, elemIdx1);
+        }
+    };
+    addPairs(trans_, undirected);
+    addPairs(thermalHalfTrans_, directed);
+    addPairs(diffusivity_, undirected);
+    addPairs(dispersivity_, undirected);
+    std::sort(pairs.begin(), pairs.end());
+    pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+    compactRowStart_.assign(numElem + 1, 0);
+    compactNeighbor_.resize(pairs.size());
+    for (std::size_t i = 0; i < pairs.size(); ++i) {
+        ++compactRowStart_[pairs[i].first + 1];
+        compactNeighbor_[i] = pairs[i].second;
+    }
+    std::partial_sum(compactRowStart_.begin(), compactRowStart_.end(), compactRowStart_.begin());
+    details::releaseStorage(pairs);
+
+    if (compactRowStart_ != previousCompactRowStart_ ||
+        compactNeighbor_ != previousCompactNeighbor_)
+    {
+        ++compactLayoutVersion_;
+    }
+    details::releaseStorage(previousCompactRowStart_);
+    details::releaseStorage(previousCompactNeighbor_);
+
+    const auto fill = [this, none](auto& map, const auto& reverse,
+                                   const bool bothDirections, std::vector<Scalar>& values)
+    {
+        values.clear();
+        if (!map.empty()) {
+            values.assign(compactNeighbor_.size(), none);
+            for (const auto& [id, value] : map) {
+                const auto [elemIdx1, elemIdx2] = reverse(id);
+                values[this->compactIndex_(elemIdx1, elemIdx2)] = value;
+                if (bothDirections) {
+                    values[this->compactIndex_(elemIdx2, elemIdx1)] = value;
+                }
+            }
+        }
+        details::releaseStorage(map);
+    };
+    fill(trans_, undirected, true, compactTrans_);
+    fill(thermalHalfTrans_, directed, false, compactThermalHalfTrans_);
+    fill(diffusivity_, undirected, true, compactDiffusivity_);
+    fill(dispersivity_, undirected, true, compactDispersivity_);
+
+    // The boundary maps are ordered by element and face already.
+    std::vector<std::pair<unsigned, unsigned>> faces;
+    faces.reserve(transBoundary_.size());
+    for (const auto* map : {&transBoundary_, &thermalHalfTransBoundary_}) {
+        for (const auto& entry : *map) {
+            faces.push_back(entry.first);
+        }
+    }
+    std::sort(faces.begin(), faces.end());
+    faces.erase(std::unique(faces.begin(), faces.end()), faces.end());
+
+    compactBoundaryRowStart_.assign(numElem + 1, 0);
+    compactBoundaryFace_.resize(faces.size());
+    for (std::size_t i = 0; i < faces.size(); ++i) {
+        ++compactBoundaryRowStart_[faces[i].first + 1];
+        compactBoundaryFace_[i] = faces[i].second;
+    }
+    std::partial_sum(compactBoundaryRowStart_.begin(), compactBoundaryRowStart_.end(),
+                     compactBoundaryRowStart_.begin());
+
+    const auto fillBoundary = [this, none](auto& map, std::vector<Scalar>& values)
+    {
+        values.clear();
+        if (!map.empty()) {
+            values.assign(compactBoundaryFace_.size(), none);
+            for (const auto& [key, value] : map) {
+                values[this->compactBoundaryIndex_(key.first, key.second)] = value;
+            }
+        }
+        details::releaseStorage(map);
+    };
+    fillBoundary(transBoundary_, compactTransBoundary_);
+    fillBoundary(thermalHalfTransBoundary_, compactThermalHalfTransBoundary_);
+}
+
+template<class Grid, class GridView, class ElementMapper, class CartesianIndexMapper, class Scalar>
+void Transmissibility<Grid,GridView,ElementMapper,CartesianIndexMapper,Scalar>::
+expandStorage_()
+{
+    const auto restore = [](auto& map, const std::vector<Scalar>& values,
+                            const std::size_t idx, const auto key)
+    {
+        if (!values.empty() && !std::isnan(values[idx])) {
+            map.insert_or_assign(key, values[idx]);
+        }
+    };
+
+    const std::size_t numRows = compactRowStart_.size() - 1;
+    for (std::size_t row = 0; row < numRows; ++row) {
+        const auto elemIdx1 = static_cast<std::uint32_t>(row);
+        for (std::size_t idx = compactRowStart_[row]; idx < compactRowStart_[row + 1]; ++idx) {
+            const std::uint32_t elemIdx2 = compactNeighbor_[idx];
+            restore(thermalHalfTrans_, compactThermalHalfTrans_, idx,
+                    details::directionalIsId(elemIdx1, elemIdx2));
+            if (elemIdx1 < elemIdx2) {
+                const auto id = details::isId(elemIdx1, elemIdx2);
+                restore(trans_, compactTrans_, idx, id);
+                restore(diffusivity_, compactDiffusivity_, idx, id);
+                restore(dispersivity_, compactDispersivity_, idx, id);
+            }
+        }
+        for (std::size_t idx = compactBoundaryRowStart_[row]; idx < compactBoundaryRowStart_[row + 1]; ++idx) {
+            const auto key = std::make_pair(static_cast<unsigned>(row), compactBoundaryFace_[idx]);
+            restore(transBoundary_, compactTransBoundary_, idx, key);
+            restore(thermalHalfTransBoundary_, compactThermalHalfTransBoundary_, idx, key);
+        }
+    }
+
+    // Kept until the next compaction, which usually recreates the same layout.
+    previousCompactRowStart_ = std::move(compactRowStart_);
+    previousCompactNeighbor_ = std::move(compactNeighbor_);
+    details::releaseStorage(compactRowStart_);
+    details::releaseStorage(compactNeighbor_);
+    details::releaseStorage(compactTrans_);
+    details::releaseStorage(compactThermalHalfTrans_);
+    details::releaseStorage(compactDiffusivity_);
+    details::releaseStorage(compactDispersivity_);
+    details::releaseStorage(compactBoundaryRowStart_);
+    details::releaseStorage(compactBoundaryFace_);
+    details::releaseStorage(compactTransBoundary_);
+    details::releaseStorage(compactThermalHalfTransBoundary_);
+}
+
+template<class Grid, class GridView, class ElementMapper, class CartesianIndexMapper, class Scalar>
+std::ptrdiff_t Transmissibility<Grid,GridView,ElementMapper,CartesianIndexMapper,Scalar>::
+compactIndex_(const unsigned elemIdx1, const unsigned elemIdx2) const
+{
+    if (elemIdx1 + 1 >= compactRowStart_.size()) {
+        return -1;
+    }
+    const auto begin = compactNeighbor_.begin() + compactRowStart_[elemIdx1];
+    const auto end = compactNeighbor_.begin() + compactRowStart_[elemIdx1 + 1];
+    const auto it = std::lower_bound(begin, end, elemIdx2);
+    return (it != end && *it == elemIdx2) ? it - compactNeighbor_.begin() : -1;
+}
+
+template<class Grid, class GridView, class ElementMapper, class CartesianIndexMapper, class Scalar>
+std::ptrdiff_t Transmissibility<Grid,GridView,ElementMapper,CartesianIndexMapper,Scalar>::
+compactBoundaryIndex_(const unsigned elemIdx, const unsigned boundaryFaceIdx) const
+{
+    if (elemIdx + 1 >= compactBoundaryRowStart_.size()) {
+        return -1;
+    }
+    const auto begin = compactBoundaryFace_.begin() + compactBoundaryRowStart_[elemIdx];
+    const auto end = compactBoundaryFace_.begin() + compactBoundaryRowStart_[elemIdx + 1];
+    const auto it = std::lower_bound(begin, end, boundaryFaceIdx);
+    return (it != end && *it == boundaryFaceIdx) ? it - compactBoundaryFace_.begin() : -1;
+}
+
+template<class Grid, class GridView, class ElementMapper, class CartesianIndexMapper, class Scalar>
+Scalar Transmissibility<Grid,GridView,ElementMapper,CartesianIndexMapper,Scalar>::
+compactValue_(const std::vector<Scalar>& values, const std::ptrdiff_t idx)
+{
+    if (idx < 0 || values.empty() || std::isnan(values[idx])) {
+        throw std::out_of_range("No transmissibility stored for the given cell pair or boundary face");
+    }
+    return values[idx];
 }
 
 template<class Grid, class GridView, class ElementMapper, class CartesianIndexMapper, class Scalar>
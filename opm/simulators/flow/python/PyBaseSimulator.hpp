@@ -67,11 +67,21 @@ public:
 
     py::array_t<double> getCellVolumes();
 
+    // Returns a (names.size(), number of cells) array with one fluid state
+    // or primary variable per row.
+    py::array_t<double> getFields(const std::vector<std::string>& names) const;
+
     double getDT();
 
     py::array_t<double> getPorosity();
 
     py::array_t<double> getPrimaryVariable(const std::string& variable) const;
+
+    // Returns a writable array referring to the primary variable in the
+    // solution vector of the simulator, without copying. Only available
+    // between step_init() and step_cleanup(). step_cleanup() makes all
+    // views read-only.
+    py::array_t<double> getPrimaryVariableView(const std::string& variable);
     py::array_t<int> getPrimaryVarMeaning(const std::string& variable) const;
 
     std::map<std::string, int>
@@ -111,6 +121,8 @@ protected:
     Simulator* simulator_{nullptr};
     std::unique_ptr<PyFluidState<TypeTag>> fluid_state_{};
     std::unique_ptr<PyMaterialState<TypeTag>> material_state_{};
+    // Views returned by getPrimaryVariableView(), see stepCleanup().
+    std::vector<py::weakref> primary_variable_views_{};
     std::shared_ptr<Deck> deck_{};
     std::shared_ptr<EclipseState> eclipse_state_{};
     std::shared_ptr<Schedule> schedule_{};
@@ -86,8 +86,10 @@ template<class TypeTag>
 py::array_t<double>
 PyBaseSimulator<TypeTag>::getCellVolumes()
 {
-    auto vector = getMaterialState().getCellVolumes();
-    return py::array(vector.size(), vector.data());
+    auto& material_state = getMaterialState();
+    py::array_t<double> array(getFluidState().numGridDof());
+    material_state.getCellVolumes(array.mutable_data());
+    return array;
 }
 
 template<class TypeTag>
@@ -100,8 +102,10 @@ template<class TypeTag>
 py::array_t<double>
 PyBaseSimulator<TypeTag>::getPorosity()
 {
-    auto vector = getMaterialState().getPorosity();
-    return py::array(vector.size(), vector.data());
+    auto& material_state = getMaterialState();
+    py::array_t<double> array(getFluidState().numGridDof());
+    material_state.getPorosity(array.mutable_data());
+    return array;
 }
 
 template<class TypeTag>
@@ -109,8 +113,22 @@ py::array_t<double>
 PyBaseSimulator<TypeTag>::
 getFluidStateVariable(const std::string& name) const
 {
-    auto vector = getFluidState().getFluidStateVariable(name);
-    return py::array(vector.size(), vector.data());
+    const auto& fluid_state = getFluidState();
+    py::array_t<double> array(fluid_state.numGridDof());
+    fluid_state.getFluidStateVariable(name, array.mutable_data());
+    return array;
+}
+
+template<class TypeTag>
+py::array_t<double>
+PyBaseSimulator<TypeTag>::
+getFields(const std::vector<std::string>& names) const
+{
+    const auto& fluid_state = getFluidState();
+    py::array_t<double> array({static_cast<py::ssize_t>(names.size()),
+                               static_cast<py::ssize_t>(fluid_state.numGridDof())});
+    fluid_state.getFields(names, array.mutable_data());
+    return array;
 }
 
 template<class TypeTag>
@@ -118,8 +136,43 @@ py::array_t<double>
 PyBaseSimulator<TypeTag>::
 getPrimaryVariable(const std::string& variable) const
 {
-    auto vector = getFluidState().getPrimaryVariable(variable);
-    return py::array(vector.size(), vector.data());
+    const auto& fluid_state = getFluidState();
+    py::array_t<double> array(fluid_state.numGridDof());
+    fluid_state.getPrimaryVariable(variable, array.mutable_data());
+    return array;
+}
+
+template<class TypeTag>
+py::array_t<double>
+PyBaseSimulator<TypeTag>::
+getPrimaryVariableView(const std::string& variable)
+{
+    if (!this->has_run_init_) {
+        throw std::logic_error("get_primary_variable_view() called before step_init()");
+    }
+    if (this->has_run_cleanup_) {
+        throw std::logic_error("get_primary_variable_view() called after step_cleanup()");
+    }
+    auto& fluid_state = getFluidState();
+    const auto [data, stride] = fluid_state.getPrimaryVariableStorage(variable);
+    if (data == nullptr) {
+        return py::array_t<double>(0);
+    }
+    // The capsule does not own the data, it only tells numpy not to copy
+    // it. The simulator, which owns the solution vector, is kept alive by
+    // the binding (py::keep_alive).
+    const py::capsule no_delete(data, [](void*) {});
+    py::array_t<double> view({static_cast<py::ssize_t>(fluid_state.numGridDof())},
+                             {static_cast<py::ssize_t>(stride)},
+                             data,
+                             no_delete);
+
+    // Remember the view so that step_cleanup() can invalidate it, and
+    // forget the views which no longer exist.
+    std::erase_if(this->primary_variable_views_,
+                  [](const py::weakref& ref) { return ref().is_none(); });
+    this->primary_variable_views_.emplace_back(view);
+    return view;
 }
 
 template<class TypeTag>
@@ -190,6 +243,14 @@ template<class TypeTag>
 int PyBaseSimulator<TypeTag>::stepCleanup()
 {
     this->has_run_cleanup_ = true;
+    // The solution must not be modified once the simulation is finalized.
+    for (const auto& ref : this->primary_variable_views_) {
+        py::object view = ref();
+        if (!view.is_none()) {
+            view.attr("flags").attr("writeable") = false;
+        }
+    }
+    this->primary_variable_views_.clear();
     return getFlowMain().executeStepsCleanup();
 }
 
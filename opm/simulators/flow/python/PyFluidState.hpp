@@ -27,7 +27,9 @@
 
 #include <cstddef>
 #include <map>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Opm::Pybind {
@@ -54,6 +56,16 @@ public:
     std::vector<double>
     getFluidStateVariable(const std::string& name) const;
 
+    // Writes the variable for all cells to data, which must hold
+    // numGridDof() values.
+    void getFluidStateVariable(const std::string& name, double* data) const;
+
+    // Writes the given fluid state and primary variables for all cells to
+    // data, one variable after the other, so data must hold
+    // names.size() * numGridDof() values. The intensive quantities of each
+    // cell are only computed once for all the variables.
+    void getFields(const std::vector<std::string>& names, double* data) const;
+
     std::vector<int>
     getPrimaryVarMeaning(const std::string& variable) const;
 
@@ -63,11 +75,24 @@ public:
     std::vector<double>
     getPrimaryVariable(const std::string &idx_name) const;
 
+    void getPrimaryVariable(const std::string& idx_name, double* data) const;
+
+    // Address of the primary variable in the first cell of the solution
+    // vector and the distance in bytes to the same variable in the next
+    // cell. Only valid until the solution vector is reallocated, i.e. until
+    // the grid changes or the simulator is destroyed.
+    std::pair<double*, std::size_t>
+    getPrimaryVariableStorage(const std::string& idx_name);
+
+    std::size_t numGridDof() const;
+
     void setPrimaryVariable(const std::string& idx_name,
                             const double* data,
                             std::size_t size);
 
 private:
+    std::optional<std::size_t> findPrimaryVarIndex_(const std::string& idx_name) const;
+
     std::size_t getPrimaryVarIndex_(const std::string& idx_name) const;
 
     int getVariableMeaning_(PrimaryVariables& primary_vars,
@@ -27,7 +27,9 @@
 
 #include <opm/material/common/MathToolbox.hpp>
 
+#include <algorithm>
 #include <stdexcept>
+#include <type_traits>
 
 #include <fmt/format.h>
 
@@ -123,15 +125,60 @@ std::vector<double>
 PyFluidState<TypeTag>::
 getFluidStateVariable(const std::string& name) const
 {
-    Model& model = this->simulator_->model();
-    const auto size = model.numGridDof();
-    std::vector<double> array(size);
+    std::vector<double> array(numGridDof());
+    getFluidStateVariable(name, array.data());
+    return array;
+}
+
+template <class TypeTag>
+void
+PyFluidState<TypeTag>::
+getFluidStateVariable(const std::string& name, double* data) const
+{
+    getFields({name}, data);
+}
+
+template <class TypeTag>
+void
+PyFluidState<TypeTag>::
+getFields(const std::vector<std::string>& names, double* data) const
+{
+    const std::size_t size = numGridDof();
+
+    // Resolve the names before touching any data. Fluid state variables
+    // are collected so that the element loop below is only done once.
+    std::vector<std::pair<VariableType, std::size_t>> fluid_state_vars;
+    std::vector<std::pair<std::size_t, std::size_t>> primary_vars;
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        if (const auto primary_var_idx = findPrimaryVarIndex_(names[i])) {
+            primary_vars.emplace_back(*primary_var_idx, i);
+        }
+        else {
+            fluid_state_vars.emplace_back(getVariableType_(names[i]), i);
+        }
+    }
+
+    // The caller's buffer may be uninitialized, and the element loop below
+    // only visits interior cells.
+    std::fill(data, data + names.size() * size, 0.0);
+
+    const auto& sol = this->simulator_->model().solution(/*timeIdx*/0);
+    for (const auto& [primary_var_idx, i] : primary_vars) {
+        double* array = data + i * size;
+        for (unsigned dof_idx = 0; dof_idx < size; ++dof_idx) {
+            array[dof_idx] = sol[dof_idx][primary_var_idx];
+        }
+    }
+
+    if (fluid_state_vars.empty()) {
+        return;
+    }
+
     const auto& grid_view = this->simulator_->vanguard().gridView();
     /* NOTE: grid_view.size(0) should give the same value as
      *  model.numGridDof()
      */
     ElementContext elem_ctx(*this->simulator_);
-    auto var_type = getVariableType_(name);
     for (const auto& elem : elements(grid_view, Dune::Partitions::interior)) {
         elem_ctx.updatePrimaryStencil(elem);
         elem_ctx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
@@ -139,27 +186,59 @@ getFluidStateVariable(const std::string& name) const
             const auto& int_quants = elem_ctx.intensiveQuantities(dof_idx, /*timeIdx=*/0);
             const auto& fs = int_quants.fluidState();
             unsigned global_dof_idx = elem_ctx.globalSpaceIndex(dof_idx, /*timeIdx=*/0);
-            array[global_dof_idx] = getVariableValue_(fs, var_type, name);
+            for (const auto& [var_type, i] : fluid_state_vars) {
+                data[i * size + global_dof_idx] = getVariableValue_(fs, var_type, names[i]);
+            }
         }
     }
-    return array;
 }
 
 template <class TypeTag>
 std::vector<double>
 PyFluidState<TypeTag>::
 getPrimaryVariable(const std::string& idx_name) const
+{
+    std::vector<double> array(numGridDof());
+    getPrimaryVariable(idx_name, array.data());
+    return array;
+}
+
+template <class TypeTag>
+void
+PyFluidState<TypeTag>::
+getPrimaryVariable(const std::string& idx_name, double* data) const
 {
     std::size_t primary_var_idx = getPrimaryVarIndex_(idx_name);
     Model& model = this->simulator_->model();
     auto& sol = model.solution(/*timeIdx*/0);
     const auto size = model.numGridDof();
-    std::vector<double> array(size);
     for (unsigned dof_idx = 0; dof_idx < size; ++dof_idx) {
-        auto primary_vars = sol[dof_idx];
-        array[dof_idx] = primary_vars[primary_var_idx];
+        data[dof_idx] = sol[dof_idx][primary_var_idx];
     }
-    return array;
+}
+
+template <class TypeTag>
+std::pair<double*, std::size_t>
+PyFluidState<TypeTag>::
+getPrimaryVariableStorage(const std::string& idx_name)
+{
+    static_assert(std::is_same_v<typename PrimaryVariables::field_type, double>,
+                  "Primary variables must be stored as double to be viewed from Python");
+    const std::size_t primary_var_idx = getPrimaryVarIndex_(idx_name);
+    auto& sol = this->simulator_->model().solution(/*timeIdx*/0);
+    if (sol.size() == 0) {
+        return {nullptr, sizeof(PrimaryVariables)};
+    }
+    // The solution is a contiguous array of PrimaryVariables objects.
+    return {&sol[0][primary_var_idx], sizeof(PrimaryVariables)};
+}
+
+template <class TypeTag>
+std::size_t
+PyFluidState<TypeTag>::
+numGridDof() const
+{
+    return this->simulator_->model().numGridDof();
 }
 
 template <class TypeTag>
@@ -189,9 +268,9 @@ setPrimaryVariable(const std::string& idx_name,
 // -------------------------------------
 
 template <class TypeTag>
-std::size_t
+std::optional<std::size_t>
 PyFluidState<TypeTag>::
-getPrimaryVarIndex_(const std::string& idx_name) const
+findPrimaryVarIndex_(const std::string& idx_name) const
 {
     if (idx_name.compare("pressure") == 0) {
         return Indices::pressureSwitchIdx;
@@ -203,9 +282,21 @@ getPrimaryVarIndex_(const std::string& idx_name) const
         return Indices::compositionSwitchIdx;
     }
     else {
+        return std::nullopt;
+    }
+}
+
+template <class TypeTag>
+std::size_t
+PyFluidState<TypeTag>::
+getPrimaryVarIndex_(const std::string& idx_name) const
+{
+    const auto primary_var_idx = findPrimaryVarIndex_(idx_name);
+    if (!primary_var_idx) {
         const std::string msg = fmt::format("Unknown primary variable index name: {}", idx_name);
         throw std::runtime_error(msg);
     }
+    return *primary_var_idx;
 }
 
 template <class TypeTag>
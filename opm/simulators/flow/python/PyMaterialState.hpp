@@ -46,6 +46,10 @@ namespace Opm::Pybind
 
         std::vector<double> getCellVolumes();
         std::vector<double> getPorosity();
+        // Write the values for all cells to data, which must hold
+        // model().numGridDof() values.
+        void getCellVolumes(double* data);
+        void getPorosity(double* data);
         void setPorosity(const double* poro, std::size_t size);
 
     private:
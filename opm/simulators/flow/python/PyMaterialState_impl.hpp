@@ -33,29 +33,45 @@ template <class TypeTag>
 std::vector<double>
 PyMaterialState<TypeTag>::
 getCellVolumes()
+{
+    std::vector<double> array(this->simulator_->model().numGridDof());
+    getCellVolumes(array.data());
+    return array;
+}
+
+template <class TypeTag>
+void
+PyMaterialState<TypeTag>::
+getCellVolumes(double* data)
 {
     Model& model = this->simulator_->model();
     const auto size = model.numGridDof();
-    std::vector<double> array(size);
     for (unsigned dof_idx = 0; dof_idx < size; ++dof_idx) {
-        array[dof_idx] = model.dofTotalVolume(dof_idx);
+        data[dof_idx] = model.dofTotalVolume(dof_idx);
     }
-    return array;
 }
 
 template <class TypeTag>
 std::vector<double>
 PyMaterialState<TypeTag>::
 getPorosity()
+{
+    std::vector<double> array(this->simulator_->model().numGridDof());
+    getPorosity(array.data());
+    return array;
+}
+
+template <class TypeTag>
+void
+PyMaterialState<TypeTag>::
+getPorosity(double* data)
 {
     Problem& problem = this->simulator_->problem();
     Model& model = this->simulator_->model();
     const auto size = model.numGridDof();
-    std::vector<double> array(size);
     for (unsigned dof_idx = 0; dof_idx < size; ++dof_idx) {
-        array[dof_idx] = problem.referencePorosity(dof_idx, /*timeIdx*/0);
+        data[dof_idx] = problem.referencePorosity(dof_idx, /*timeIdx*/0);
     }
-    return array;
 }
 
 template <class TypeTag>
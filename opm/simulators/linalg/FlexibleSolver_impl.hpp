@@ -195,12 +195,22 @@ namespace Dune
                 const std::string prec_type = prm.get<std::string>("preconditioner.type", "error");
                 bool use_mixed_dilu= (prec_type=="mixed-dilu");
                 using MatrixType = decltype(linearoperator_for_solver_->getmat());
-                linsolver_ = std::make_shared<Dune::MixedSolver<VectorType,MatrixType>>(
-                                                                            linearoperator_for_solver_->getmat(),
-                                                                            tol,
-                                                                            maxiter,
-                                                                            use_mixed_dilu
-                                                                        );
+                if constexpr (std::is_same_v<Comm, Dune::Amg::SequentialInformation>) {
+                    linsolver_ = std::make_shared<Dune::MixedSolver<VectorType,MatrixType>>(
+                                                                                linearoperator_for_solver_->getmat(),
+                                                                                tol,
+                                                                                maxiter,
+                                                                                use_mixed_dilu
+                                                                            );
+                } else {
+                    linsolver_ = std::make_shared<Dune::MixedSolver<VectorType,MatrixType,Comm>>(
+                                                                                linearoperator_for_solver_->getmat(),
+                                                                                tol,
+                                                                                maxiter,
+                                                                                use_mixed_dilu,
+                                                                                comm
+                                                                            );
+                }
             }
 #endif
         } else if (solver_type == "loopsolver") {
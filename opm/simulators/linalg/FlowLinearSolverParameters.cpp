@@ -69,6 +69,7 @@ void FlowLinearSolverParameters::init(bool cprRequestedInDataFile)
 
     accelerator_mode_ = Parameters::Get<Parameters::AcceleratorMode>();
     cpr_weights_thread_parallel_ = Parameters::Get<Parameters::CprWeightsThreadParallel>();
+    well_operator_thread_parallel_ = Parameters::Get<Parameters::WellOperatorThreadParallel>();
     gpu_device_id_ = Parameters::Get<Parameters::GpuDeviceId>();
     opencl_platform_id_ = Parameters::Get<Parameters::OpenclPlatformId>();
     opencl_ilu_parallel_ = Parameters::Get<Parameters::OpenclIluParallel>();
@@ -184,6 +185,9 @@ void FlowLinearSolverParameters::registerParameters()
     Parameters::Register<Parameters::CprWeightsThreadParallel>
         ("Enable OpenMP thread parallelization of CPR weight calculation. "
             "This can improve performance for large models but is disabled by default");
+    Parameters::Register<Parameters::WellOperatorThreadParallel>
+        ("Enable OpenMP thread parallelization of the well contributions to the "
+            "linear operator when they are not added to the matrix");
 
     Parameters::SetDefault<Parameters::LinearSolverVerbosity>(0);
 }
@@ -216,6 +220,7 @@ void FlowLinearSolverParameters::reset()
     gpu_aware_mpi_              = false;
     verify_gpu_aware_mpi_       = false;
     cpr_weights_thread_parallel_ = false;
+    well_operator_thread_parallel_ = true;
 }
 
 } // namespace Opm
@@ -89,6 +89,7 @@ struct OpenclIluParallel { static constexpr bool value = true; }; // note: false
 struct GpuAwareMpi { static constexpr bool value = false; };
 struct VerifyGpuAwareMpi { static constexpr bool value = false; };
 struct CprWeightsThreadParallel { static constexpr bool value = false; };
+struct WellOperatorThreadParallel { static constexpr bool value = true; };
 } // namespace Opm::Parameters
 
 namespace Opm {
@@ -122,6 +123,7 @@ struct FlowLinearSolverParameters
     bool gpu_aware_mpi_;
     bool verify_gpu_aware_mpi_;
     bool cpr_weights_thread_parallel_;
+    bool well_operator_thread_parallel_;
 
     FlowLinearSolverParameters() { reset(); }
 
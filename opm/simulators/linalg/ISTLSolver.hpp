@@ -497,7 +497,8 @@ std::unique_ptr<Matrix> blockJacobiAdjacency(const Grid& grid,
                         flexibleSolver_[activeSolverNum_].wellOperator_ = std::move(wellOp);
                     }
                     else {
-                        auto wellOp = std::make_unique<WellModelOperator>(simulator_.problem().wellModel());
+                        auto wellOp = std::make_unique<WellModelOperator>(simulator_.problem().wellModel(),
+                                                                          parameters_[activeSolverNum_].well_operator_thread_parallel_);
                         flexibleSolver_[activeSolverNum_].wellOperator_ = std::move(wellOp);
                     }
                 }
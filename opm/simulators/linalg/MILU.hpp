@@ -103,6 +103,19 @@ void milu0_decomposition(M& A, FieldFunct<M> absFunctor = signFunctor<typename M
                          FieldFunct<M> signFunctor = oneFunctor<typename M::field_type>,
                          std::vector<typename M::block_type>* diagonal = nullptr);
 
+/// \brief Compute the MILU0 decomposition of row i of A in place.
+///
+/// The rows referenced by the strictly lower part of row i must already have
+/// been decomposed. Rows not referencing each other can thus be decomposed
+/// concurrently.
+/// If diagonal is not null, the modified diagonal block is stored there
+/// before it is inverted.
+template <typename M>
+void milu0_decomposition_row(M& A, std::size_t i,
+                             FieldFunct<M> absFunctor = signFunctor<typename M::field_type>,
+                             FieldFunct<M> signFunctor = oneFunctor<typename M::field_type>,
+                             typename M::block_type* diagonal = nullptr);
+
 template<class M>
 void  milu0_decomposition(M& A, std::vector<typename M::block_type>* diagonal)
 {
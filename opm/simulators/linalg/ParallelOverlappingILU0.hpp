@@ -42,7 +42,7 @@ class ParallelOverlappingILU0Args
 {
  public:
     explicit ParallelOverlappingILU0Args(MILU_VARIANT milu = MILU_VARIANT::ILU )
-        : milu_(milu), n_(0)
+        : milu_(milu), n_(0), levelScheduling_(false)
     {}
     void setMilu(MILU_VARIANT milu)
     {
@@ -60,9 +60,18 @@ class ParallelOverlappingILU0Args
     {
         return n_;
     }
+    void setLevelScheduling(bool levelScheduling)
+    {
+        levelScheduling_ = levelScheduling;
+    }
+    bool getLevelScheduling() const
+    {
+        return levelScheduling_;
+    }
  private:
     MILU_VARIANT milu_;
     int n_;
+    bool levelScheduling_;
 };
 } // end namespace Opm
 
@@ -100,7 +109,9 @@ struct ConstructionTraits<Opm::ParallelOverlappingILU0<Matrix,Domain,Range,Paral
                       args.getComm(),
                       args.getArgs().getN(),
                       args.getArgs().relaxationFactor,
-                      args.getArgs().getMilu()) );
+                      args.getArgs().getMilu(),
+                      false, true,
+                      args.getArgs().getLevelScheduling()) );
     }
 };
 
@@ -216,11 +227,16 @@ public:
                             The vertices on each layer aound it (same distance) are
                             ordered consecutivly. If false, we preserver the order of
                             the vertices with the same color.
+      \param level_scheduling Whether to order the rows by level sets of the
+                              lower triangular dependencies and process each
+                              level in parallel. Only used for ILU0 without
+                              red-black ordering. \see setupLevelScheduling
     */
     ParallelOverlappingILU0 (const Matrix& A,
                              const int n, const field_type w,
                              MILU_VARIANT milu, bool redblack = false,
-                             bool reorder_sphere = true);
+                             bool reorder_sphere = true,
+                             bool level_scheduling = false);
 
     /*! \brief Constructor gets all parameters to operate the prec.
       \param A The matrix to operate on.
@@ -233,11 +249,16 @@ public:
                             The vertices on each layer aound it (same distance) are
                             ordered consecutivly. If false, we preserver the order of
                             the vertices with the same color.
+      \param level_scheduling Whether to order the rows by level sets of the
+                              lower triangular dependencies and process each
+                              level in parallel. Only used for ILU0 without
+                              red-black ordering. \see setupLevelScheduling
     */
     ParallelOverlappingILU0 (const Matrix& A,
                              const ParallelInfo& comm, const int n, const field_type w,
                              MILU_VARIANT milu, bool redblack = false,
-                             bool reorder_sphere = true);
+                             bool reorder_sphere = true,
+                             bool level_scheduling = false);
 
     /*! \brief Constructor.
 
@@ -250,11 +271,16 @@ public:
                   The vertices on each layer aound it (same distance) are
                   ordered consecutivly. If false, we preserver the order of
                   the vertices with the same color.
+      \param level_scheduling Whether to order the rows by level sets of the
+                              lower triangular dependencies and process each
+                              level in parallel. Only used for ILU0 without
+                              red-black ordering. \see setupLevelScheduling
     */
     ParallelOverlappingILU0 (const Matrix& A,
                              const field_type w, MILU_VARIANT milu,
                              bool redblack = false,
-                             bool reorder_sphere = true);
+                             bool reorder_sphere = true,
+                             bool level_scheduling = false);
 
     /*! \brief Constructor.
 
@@ -268,11 +294,16 @@ public:
                             The vertices on each layer aound it (same distance) are
                             ordered consecutivly. If false, we preserver the order of
                             the vertices with the same color.
+      \param level_scheduling Whether to order the rows by level sets of the
+                              lower triangular dependencies and process each
+                              level in parallel. Only used for ILU0 without
+                              red-black ordering. \see setupLevelScheduling
     */
     ParallelOverlappingILU0 (const Matrix& A,
                              const ParallelInfo& comm, const field_type w,
                              MILU_VARIANT milu, bool redblack = false,
-                             bool reorder_sphere = true);
+                             bool reorder_sphere = true,
+                             bool level_scheduling = false);
 
     /*! \brief Constructor.
 
@@ -287,12 +318,17 @@ public:
                             The vertices on each layer aound it (same distance) are
                             ordered consecutivly. If false, we preserver the order of
                             the vertices with the same color.
+      \param level_scheduling Whether to order the rows by level sets of the
+                              lower triangular dependencies and process each
+                              level in parallel. Only used for ILU0 without
+                              red-black ordering. \see setupLevelScheduling
     */
     ParallelOverlappingILU0 (const Matrix& A,
                              const ParallelInfo& comm,
                              const field_type w, MILU_VARIANT milu,
                              size_type interiorSize, bool redblack = false,
-                             bool reorder_sphere = true);
+                             bool reorder_sphere = true,
+                             bool level_scheduling = false);
 
     /*!
       \brief Prepare the preconditioner.
@@ -331,6 +367,24 @@ protected:
 
     void reorderBack(const Range& reorderedV, Range& v);
 
+    /// \brief Compute the level scheduled ordering of the interior rows.
+    ///
+    /// The interior rows are grouped into levels such that the rows of a
+    /// level only depend on rows of earlier levels through the lower
+    /// triangular part of the matrix. The rows are then numbered level by
+    /// level, keeping their relative order within a level, and the ghost
+    /// rows are kept last. Both the factorization and the triangular solves
+    /// can then process all rows of a level in parallel. For a structurally
+    /// symmetric matrix the reordering keeps every entry on the same side of
+    /// the diagonal, so the factorization equals the one of the natural
+    /// ordering up to round-off. If rows of the same level are coupled, which
+    /// may only happen for unsymmetric sparsity patterns, level scheduling is
+    /// switched off.
+    void setupLevelScheduling();
+
+    /// \brief Decompose the reordered matrix ILU_ level by level.
+    void levelScheduledDecomposition();
+
     //! \brief The ILU0 decomposition of the matrix.
     std::unique_ptr<Matrix> ILU_;
     CRS lower_;
@@ -338,6 +392,9 @@ protected:
     std::vector< block_type > inv_;
     //! \brief the reordering of the unknowns
     std::vector< std::size_t > ordering_;
+    //! \brief The first reordered row of each level and the number of
+    //! interior rows as the last entry. Empty without level scheduling.
+    std::vector< size_type > levelStart_;
     //! \brief The reordered right hand side
     Range reorderedD_;
     //! \brief The reordered left hand side.
@@ -353,6 +410,7 @@ protected:
     MILU_VARIANT milu_;
     bool redBlack_;
     bool reorderSphere_;
+    bool levelScheduling_;
 };
 
 } // end namespace Opm
@@ -32,69 +32,86 @@
 #include <opm/simulators/linalg/matrixblock.hh>
 
 #include <cassert>
+#include <cstddef>
+#include <exception>
+#include <functional>
 
 namespace Opm
 {
 namespace detail
 {
 
-//! Compute Blocked ILU0 decomposition, when we know junk ghost rows are located at the end of A
+//! Compute the blocked ILU0 decomposition of row i of A in place. The rows
+//! referenced by the lower part of row i must already be decomposed.
 template<class M>
-void ghost_last_bilu0_decomposition (M& A, std::size_t interiorSize)
+void bilu0_decomposition_row (M& A, std::size_t i)
 {
-    OPM_TIMEBLOCK(GhostLastBlockILU0Decomp);
     // iterator types
-    assert(interiorSize <= A.N());
-    using rowiterator = typename M::RowIterator;
     using coliterator = typename M::ColIterator;
     using block = typename M::block_type;
 
-    // implement left looking variant with stored inverse
-    for (rowiterator i = A.begin(); i.index() < interiorSize; ++i)
-    {
-        // coliterator is diagonal after the following loop
-        coliterator endij=(*i).end();           // end of row i
-        coliterator ij;
+    // coliterator is diagonal after the following loop
+    coliterator endij=A[i].end();           // end of row i
+    coliterator ij;
 
-        // eliminate entries left of diagonal; store L factor
-        for (ij=(*i).begin(); ij.index()<i.index(); ++ij)
-        {
-            // find A_jj which eliminates A_ij
-            coliterator jj = A[ij.index()].find(ij.index());
-
-            // compute L_ij = A_jj^-1 * A_ij
-            (*ij).rightmultiply(*jj);
-
-            // modify row
-            coliterator endjk=A[ij.index()].end();    // end of row j
-            coliterator jk=jj; ++jk;
-            coliterator ik=ij; ++ik;
-            while (ik!=endij && jk!=endjk)
-                if (ik.index()==jk.index())
-                {
-                    block B(*jk);
-                    B.leftmultiply(*ij);
-                    *ik -= B;
-                    ++ik; ++jk;
-                }
+    // eliminate entries left of diagonal; store L factor
+    for (ij=A[i].begin(); ij.index()<i; ++ij)
+    {
+        // find A_jj which eliminates A_ij
+        coliterator jj = A[ij.index()].find(ij.index());
+
+        // compute L_ij = A_jj^-1 * A_ij
+        (*ij).rightmultiply(*jj);
+
+        // modify row
+        coliterator endjk=A[ij.index()].end();    // end of row j
+        coliterator jk=jj; ++jk;
+        coliterator ik=ij; ++ik;
+        while (ik!=endij && jk!=endjk)
+            if (ik.index()==jk.index())
+            {
+                block B(*jk);
+                B.leftmultiply(*ij);
+                *ik -= B;
+                ++ik; ++jk;
+            }
+            else
+            {
+                if (ik.index()<jk.index())
+                    ++ik;
                 else
-                {
-                    if (ik.index()<jk.index())
-                        ++ik;
-                    else
-                        ++jk;
-                }
-        }
+                    ++jk;
+            }
+    }
 
-        // invert pivot and store it in A
-        if (ij.index()!=i.index())
-            DUNE_THROW(Dune::ISTLError,"diagonal entry missing");
-        try {
-            (*ij).invert();   // compute inverse of diagonal block
-        }
-        catch (Dune::FMatrixError & e) {
-            DUNE_THROW(Dune::ISTLError,"ILU failed to invert matrix block");
-        }
+    // invert pivot and store it in A
+    if (ij.index()!=i)
+        DUNE_THROW(Dune::ISTLError,"diagonal entry missing");
+    try {
+        (*ij).invert();   // compute inverse of diagonal block
+    }
+    catch (Dune::FMatrixError & e) {
+        // Same error as Dune::ILU::blockILU0Decomposition such that
+        // the failure is handled collectively in update().
+        Dune::MatrixBlockError ex;
+        ex.message("ILU failed to invert matrix block");
+        ex.r = i;
+        ex.c = i;
+        throw ex;
+    }
+}
+
+//! Compute Blocked ILU0 decomposition, when we know junk ghost rows are located at the end of A
+template<class M>
+void ghost_last_bilu0_decomposition (M& A, std::size_t interiorSize)
+{
+    OPM_TIMEBLOCK(GhostLastBlockILU0Decomp);
+    assert(interiorSize <= A.N());
+
+    // implement left looking variant with stored inverse
+    for (std::size_t i = 0; i < interiorSize; ++i)
+    {
+        bilu0_decomposition_row(A, i);
     }
 }
 
@@ -234,14 +251,15 @@ ParallelOverlappingILU0<Matrix,Domain,Range,ParallelInfoT>::
 ParallelOverlappingILU0(const Matrix& A,
                         const int n, const field_type w,
                         MILU_VARIANT milu, bool redblack,
-                        bool reorder_sphere)
+                        bool reorder_sphere, bool level_scheduling)
     : lower_(),
       upper_(),
       inv_(),
       comm_(nullptr), w_(w),
       relaxation_( std::abs( w - 1.0 ) > 1e-15 ),
       A_(&reinterpret_cast<const Matrix&>(A)), iluIteration_(n),
-      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere)
+      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere),
+      levelScheduling_(level_scheduling && !redblack && n == 0)
 {
     interiorSize_ = A.N();
     // BlockMatrix is a Subclass of FieldMatrix that just adds
@@ -254,14 +272,15 @@ ParallelOverlappingILU0<Matrix,Domain,Range,ParallelInfoT>::
 ParallelOverlappingILU0(const Matrix& A,
                         const ParallelInfo& comm, const int n, const field_type w,
                         MILU_VARIANT milu, bool redblack,
-                        bool reorder_sphere)
+                        bool reorder_sphere, bool level_scheduling)
     : lower_(),
       upper_(),
       inv_(),
       comm_(&comm), w_(w),
       relaxation_( std::abs( w - 1.0 ) > 1e-15 ),
       A_(&reinterpret_cast<const Matrix&>(A)), iluIteration_(n),
-      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere)
+      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere),
+      levelScheduling_(level_scheduling && !redblack && n == 0)
 {
     interiorSize_ = A.N();
     // BlockMatrix is a Subclass of FieldMatrix that just adds
@@ -273,8 +292,9 @@ template<class Matrix, class Domain, class Range, class ParallelInfoT>
 ParallelOverlappingILU0<Matrix,Domain,Range,ParallelInfoT>::
 ParallelOverlappingILU0(const Matrix& A,
                         const field_type w, MILU_VARIANT milu, bool redblack,
-                        bool reorder_sphere)
-    : ParallelOverlappingILU0( A, 0, w, milu, redblack, reorder_sphere )
+                        bool reorder_sphere, bool level_scheduling)
+    : ParallelOverlappingILU0( A, 0, w, milu, redblack, reorder_sphere,
+                               level_scheduling )
 {}
 
 template<class Matrix, class Domain, class Range, class ParallelInfoT>
@@ -282,14 +302,15 @@ ParallelOverlappingILU0<Matrix,Domain,Range,ParallelInfoT>::
 ParallelOverlappingILU0(const Matrix& A,
                         const ParallelInfo& comm, const field_type w,
                         MILU_VARIANT milu, bool redblack,
-                        bool reorder_sphere)
+                        bool reorder_sphere, bool level_scheduling)
     : lower_(),
       upper_(),
       inv_(),
       comm_(&comm), w_(w),
       relaxation_( std::abs( w - 1.0 ) > 1e-15 ),
       A_(&reinterpret_cast<const Matrix&>(A)), iluIteration_(0),
-      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere)
+      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere),
+      levelScheduling_(level_scheduling && !redblack)
 {
     interiorSize_ = A.N();
     // BlockMatrix is a Subclass of FieldMatrix that just adds
@@ -303,7 +324,7 @@ ParallelOverlappingILU0(const Matrix& A,
                         const ParallelInfo& comm,
                         const field_type w, MILU_VARIANT milu,
                         size_type interiorSize, bool redblack,
-                        bool reorder_sphere)
+                        bool reorder_sphere, bool level_scheduling)
     : lower_(),
       upper_(),
       inv_(),
@@ -311,7 +332,8 @@ ParallelOverlappingILU0(const Matrix& A,
       relaxation_( std::abs( w - 1.0 ) > 1e-15 ),
       interiorSize_(interiorSize),
       A_(&reinterpret_cast<const Matrix&>(A)), iluIteration_(0),
-      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere)
+      milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere),
+      levelScheduling_(level_scheduling && !redblack)
 {
     // BlockMatrix is a Subclass of FieldMatrix that just adds
     // methods. Therefore this cast should be safe.
@@ -340,8 +362,7 @@ apply (Domain& v, const Range& d)
         OPM_THROW(std::logic_error,"ILU: number of lower and upper rows must be the same");
     }
 
-    // lower triangular solve
-    for (size_type i = 0; i < lowerLoopEnd; ++i)
+    auto lowerSolveRow = [&](const size_type i)
     {
         dblock rhs( md[ i ] );
         const size_type rowI     = lower_.rows_[ i ];
@@ -353,9 +374,9 @@ apply (Domain& v, const Range& d)
         }
 
         mv[ i ] = rhs;  // Lii = I
-    }
+    };
 
-    for (size_type i = upperLoopStart; i < iEnd; ++i)
+    auto upperSolveRow = [&](const size_type i)
     {
         vblock& vBlock = mv[ lastRow - i ];
         vblock rhs ( vBlock );
@@ -369,14 +390,58 @@ apply (Domain& v, const Range& d)
 
         // apply inverse and store result
         inv_[ i ].mv( rhs, vBlock);
+    };
+
+    if (levelStart_.empty())
+    {
+        // lower triangular solve
+        for (size_type i = 0; i < lowerLoopEnd; ++i)
+        {
+            lowerSolveRow(i);
+        }
+
+        for (size_type i = upperLoopStart; i < iEnd; ++i)
+        {
+            upperSolveRow(i);
+        }
     }
+    else
+    {
+        // The rows of a level do not depend on each other.
+        const std::size_t numLevels = levelStart_.size() - 1;
+        for (std::size_t level = 0; level < numLevels; ++level)
+        {
+            const auto levelEnd = static_cast<std::ptrdiff_t>(levelStart_[level + 1]);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for (auto i = static_cast<std::ptrdiff_t>(levelStart_[level]); i < levelEnd; ++i)
+            {
+                lowerSolveRow(i);
+            }
+        }
 
-    copyOwnerToAll( mv );
+        // upper_ and inv_ are stored in reverse row order
+        for (std::size_t level = numLevels; level-- > 0; )
+        {
+            const auto levelEnd = static_cast<std::ptrdiff_t>(iEnd - levelStart_[level]);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for (auto i = static_cast<std::ptrdiff_t>(iEnd - levelStart_[level + 1]); i < levelEnd; ++i)
+            {
+                upperSolveRow(i);
+            }
+        }
+    }
 
     if( relaxation_ ) {
         mv *= w_;
     }
     reorderBack(mv, v);
+
+    // The communication uses the original numbering of the unknowns.
+    copyOwnerToAll( v );
 }
 
 template<class Matrix, class Domain, class Range, class ParallelInfoT>
@@ -414,6 +479,15 @@ update()
     std::string message;
     const int rank = comm_ ? comm_->communicator().rank() : 0;
 
+    if (levelScheduling_ && levelStart_.empty())
+    {
+        if (comm_) {
+            interiorSize_ = detail::set_interiorSize(A_->N(), interiorSize_, *comm_);
+            assert(interiorSize_ <= A_->N());
+        }
+        setupLevelScheduling();
+    }
+
     if (redBlack_)
     {
         using Graph = Dune::Amg::MatrixGraph<const Matrix>;
@@ -480,18 +554,23 @@ update()
             }
             else
             {
-                ILU_ = std::make_unique<Matrix>(A_->N(), A_->M(),
-                                                A_->nonzeroes(), Matrix::row_wise);
-                auto& newA = *ILU_;
-                // Create sparsity pattern
-                for (auto iter = newA.createbegin(), iend = newA.createend(); iter != iend; ++iter)
+                // The level scheduled ordering is computed once, so the
+                // sparsity pattern of the reordered copy can be reused.
+                if (!ILU_ || levelStart_.empty())
                 {
-                    const auto& row = (*A_)[inverseOrdering[iter.index()]];
-                    for (auto col = row.begin(), cend = row.end(); col != cend; ++col)
+                    ILU_ = std::make_unique<Matrix>(A_->N(), A_->M(),
+                                                    A_->nonzeroes(), Matrix::row_wise);
+                    // Create sparsity pattern
+                    for (auto iter = ILU_->createbegin(), iend = ILU_->createend(); iter != iend; ++iter)
                     {
-                        iter.insert(ordering_[col.index()]);
+                        const auto& row = (*A_)[inverseOrdering[iter.index()]];
+                        for (auto col = row.begin(), cend = row.end(); col != cend; ++col)
+                        {
+                            iter.insert(ordering_[col.index()]);
+                        }
                     }
                 }
+                auto& newA = *ILU_;
                 // Copy values
                 for (auto iter = A_->begin(), iend = A_->end(); iter != iend; ++iter)
                 {
@@ -503,29 +582,36 @@ update()
                 }
             }
 
-            switch (milu_)
+            if (!levelStart_.empty())
             {
-            case MILU_VARIANT::MILU_1:
-                detail::milu0_decomposition ( *ILU_);
-                break;
-            case MILU_VARIANT::MILU_2:
-                detail::milu0_decomposition ( *ILU_, detail::identityFunctor<typename Matrix::field_type>,
-                                              detail::signFunctor<typename Matrix::field_type> );
-                break;
-            case MILU_VARIANT::MILU_3:
-                detail::milu0_decomposition ( *ILU_, detail::absFunctor<typename Matrix::field_type>,
-                                              detail::signFunctor<typename Matrix::field_type> );
-                break;
-            case MILU_VARIANT::MILU_4:
-                detail::milu0_decomposition ( *ILU_, detail::identityFunctor<typename Matrix::field_type>,
-                                              detail::isPositiveFunctor<typename Matrix::field_type> );
-                break;
-            default:
-                if (interiorSize_ == A_->N())
-                    Dune::ILU::blockILU0Decomposition( *ILU_ );
-                else
-                    detail::ghost_last_bilu0_decomposition(*ILU_, interiorSize_);
-                break;
+                levelScheduledDecomposition();
+            }
+            else
+            {
+                switch (milu_)
+                {
+                case MILU_VARIANT::MILU_1:
+                    detail::milu0_decomposition ( *ILU_);
+                    break;
+                case MILU_VARIANT::MILU_2:
+                    detail::milu0_decomposition ( *ILU_, detail::identityFunctor<typename Matrix::field_type>,
+                                                  detail::signFunctor<typename Matrix::field_type> );
+                    break;
+                case MILU_VARIANT::MILU_3:
+                    detail::milu0_decomposition ( *ILU_, detail::absFunctor<typename Matrix::field_type>,
+                                                  detail::signFunctor<typename Matrix::field_type> );
+                    break;
+                case MILU_VARIANT::MILU_4:
+                    detail::milu0_decomposition ( *ILU_, detail::identityFunctor<typename Matrix::field_type>,
+                                                  detail::isPositiveFunctor<typename Matrix::field_type> );
+                    break;
+                default:
+                    if (interiorSize_ == A_->N())
+                        Dune::ILU::blockILU0Decomposition( *ILU_ );
+                    else
+                        detail::ghost_last_bilu0_decomposition(*ILU_, interiorSize_);
+                    break;
+                }
             }
         }
         else {
@@ -570,6 +656,141 @@ update()
     detail::convertToCRS(*ILU_, lower_, upper_, inv_);
 }
 
+template<class Matrix, class Domain, class Range, class ParallelInfoT>
+void ParallelOverlappingILU0<Matrix,Domain,Range,ParallelInfoT>::
+setupLevelScheduling()
+{
+    OPM_TIMEBLOCK(setupLevelScheduling);
+    const auto levelSets = getMatrixRowColoring(*A_, ColoringType::LOWER);
+
+    std::vector<std::size_t> level(A_->N());
+    ordering_.assign(A_->N(), 0);
+    levelStart_.assign(1, 0);
+    std::size_t index = 0;
+    for (std::size_t l = 0; l < levelSets.size(); ++l)
+    {
+        for (const auto row : levelSets[l])
+        {
+            if (row < interiorSize_)
+            {
+                level[row] = l;
+                ordering_[row] = index++;
+            }
+        }
+        if (index > levelStart_.back())
+        {
+            levelStart_.push_back(index);
+        }
+    }
+    assert(index == interiorSize_);
+    for (std::size_t row = interiorSize_; row < A_->N(); ++row)
+    {
+        ordering_[row] = row;
+    }
+
+    // Rows of the same level must not be coupled through the upper
+    // triangular part either.
+    for (auto row = A_->begin(); row.index() < interiorSize_; ++row)
+    {
+        for (auto col = row->begin(); col != row->end(); ++col)
+        {
+            if (col.index() != row.index() && col.index() < interiorSize_ &&
+                level[col.index()] == level[row.index()])
+            {
+                ordering_.clear();
+                levelStart_.clear();
+                levelScheduling_ = false;
+                return;
+            }
+        }
+    }
+}
+
+template<class Matrix, class Domain, class Range, class ParallelInfoT>
+void ParallelOverlappingILU0<Matrix,Domain,Range,ParallelInfoT>::
+levelScheduledDecomposition()
+{
+    OPM_TIMEBLOCK(levelScheduledDecomposition);
+    using Field = typename Matrix::field_type;
+    auto& ILU = *ILU_;
+
+    std::function<void(std::size_t)> decomposeRow;
+    switch (milu_)
+    {
+    case MILU_VARIANT::MILU_1:
+        decomposeRow = [&ILU](std::size_t i)
+        {
+            detail::milu0_decomposition_row(ILU, i);
+        };
+        break;
+    case MILU_VARIANT::MILU_2:
+        decomposeRow = [&ILU](std::size_t i)
+        {
+            detail::milu0_decomposition_row(ILU, i, detail::identityFunctor<Field>,
+                                            detail::signFunctor<Field>);
+        };
+        break;
+    case MILU_VARIANT::MILU_3:
+        decomposeRow = [&ILU](std::size_t i)
+        {
+            detail::milu0_decomposition_row(ILU, i, detail::absFunctor<Field>,
+                                            detail::signFunctor<Field>);
+        };
+        break;
+    case MILU_VARIANT::MILU_4:
+        decomposeRow = [&ILU](std::size_t i)
+        {
+            detail::milu0_decomposition_row(ILU, i, detail::identityFunctor<Field>,
+                                            detail::isPositiveFunctor<Field>);
+        };
+        break;
+    default:
+        decomposeRow = [&ILU](std::size_t i)
+        {
+            detail::bilu0_decomposition_row(ILU, i);
+        };
+        break;
+    }
+
+    // Exceptions must not leave an OpenMP region, hence the first one
+    // is stored and rethrown after the level.
+    std::exception_ptr error;
+    for (std::size_t level = 0; level + 1 < levelStart_.size(); ++level)
+    {
+        const auto levelEnd = static_cast<std::ptrdiff_t>(levelStart_[level + 1]);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (auto i = static_cast<std::ptrdiff_t>(levelStart_[level]); i < levelEnd; ++i)
+        {
+            try {
+                decomposeRow(i);
+            }
+            catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(levelScheduledDecomposition)
+#endif
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // As for the natural ordering, the ghost rows are only decomposed
+    // by the modified ILU variants.
+    if (milu_ != MILU_VARIANT::ILU)
+    {
+        for (std::size_t i = interiorSize_; i < ILU.N(); ++i)
+        {
+            decomposeRow(i);
+        }
+    }
+}
+
 template<class Matrix, class Domain, class Range, class ParallelInfoT>
 Range& ParallelOverlappingILU0<Matrix,Domain,Range,ParallelInfoT>::
 reorderD(const Range& d)
@@ -35,20 +35,6 @@
 
 namespace Opm {
 
-template <class X, class Y>
-class TrivialPreconditioner : public Dune::PreconditionerWithUpdate<X, Y>
-{
-    public:
-    TrivialPreconditioner(){};
-    virtual void update() override {};
-    virtual bool hasPerfectUpdate() const override {return true;}
-    virtual void pre ([[maybe_unused]] X& x, [[maybe_unused]] Y& y) override {};
-    virtual void post ([[maybe_unused]] X& x) override {};
-    virtual void apply ([[maybe_unused]] X& x, [[maybe_unused]] const Y& y) override {};
-    virtual Dune::SolverCategory::Category category() const override { return Dune::SolverCategory::sequential; };
-};
-
-
 template <class Operator>
 struct StandardPreconditioners<Operator, Dune::Amg::SequentialInformation, typename std::enable_if_t<!Opm::is_gpu_operator_v<Operator>>>
 {
@@ -63,8 +49,9 @@ struct StandardPreconditioners<Operator, Dune::Amg::SequentialInformation, typen
         using P = PropertyTree;
         F::addCreator("ilu0", [](const O& op, const P& prm, const std::function<V()>&, std::size_t) {
             const double w = prm.get<double>("relaxation", 1.0);
+            const bool level_scheduling = prm.get<bool>("level_scheduling", false);
             return std::make_shared<ParallelOverlappingILU0<M, V, V, C>>(
-                op.getmat(), 0, w, MILU_VARIANT::ILU);
+                op.getmat(), 0, w, MILU_VARIANT::ILU, false, true, level_scheduling);
         });
         F::addCreator("duneilu", [](const O& op, const P& prm, const std::function<V()>&, std::size_t) {
             const double w = prm.get<double>("relaxation", 1.0);
@@ -75,8 +62,9 @@ struct StandardPreconditioners<Operator, Dune::Amg::SequentialInformation, typen
         F::addCreator("paroverilu0", [](const O& op, const P& prm, const std::function<V()>&, std::size_t) {
             const double w = prm.get<double>("relaxation", 1.0);
             const int n = prm.get<int>("ilulevel", 0);
+            const bool level_scheduling = prm.get<bool>("level_scheduling", false);
             return std::make_shared<ParallelOverlappingILU0<M, V, V, C>>(
-                op.getmat(), n, w, MILU_VARIANT::ILU);
+                op.getmat(), n, w, MILU_VARIANT::ILU, false, true, level_scheduling);
         });
         F::addCreator("ilun", [](const O& op, const P& prm, const std::function<V()>&, std::size_t) {
             const int n = prm.get<int>("ilulevel", 0);
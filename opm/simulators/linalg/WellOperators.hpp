@@ -32,7 +32,15 @@
 #include <dune/common/shared_ptr.hh>
 #include <dune/istl/paamg/smoother.hh>
 
+#include <algorithm>
 #include <cstddef>
+#include <optional>
+#include <unordered_set>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 namespace Opm {
 
@@ -72,8 +80,11 @@ public:
     using Base = LinearOperatorExtra<X, Y>;
     using field_type = typename Base::field_type;
     using PressureMatrix = typename Base::PressureMatrix;
-    explicit WellModelAsLinearOperator(const WellModel& wm)
+    /// With threadParallel the wells are applied on OpenMP threads.
+    explicit WellModelAsLinearOperator(const WellModel& wm,
+                                       const bool threadParallel = false)
         : wellMod_(wm)
+        , threadParallel_(threadParallel)
     {
     }
 
@@ -84,8 +95,14 @@ public:
     void apply(const X& x, Y& y) const override
     {
         OPM_TIMEBLOCK(apply);
+#ifdef _OPENMP
+        if (threadParallel_ && omp_get_max_threads() > 1 && !omp_in_parallel()) {
+            this->applyThreaded(x, y);
+            return;
+        }
+#endif
         for (const auto& well : this->wellMod_) {
-            this->applySingleWell(x, y, well, well->cells());
+            this->applySingleWell(x, y, well, well->cells(), x_local_, Ax_local_);
         }
     }
 
@@ -139,26 +156,29 @@ public:
 
 protected:
     const WellModel& wellMod_;
+    bool threadParallel_ = false;
 
     template<class WellType, class ArrayType>
     void applySingleWell(const X& x, Y& y,
                          const WellType& well,
-                         const ArrayType& cells) const
+                         const ArrayType& cells,
+                         X& x_local,
+                         Y& Ax_local) const
     {
         // Well equations B and C uses only the perforated cells, so need to apply on local vectors
-        x_local_.resize(cells.size());
-        Ax_local_.resize(cells.size());
+        x_local.resize(cells.size());
+        Ax_local.resize(cells.size());
 
         for (size_t i = 0; i < cells.size(); ++i) {
-            x_local_[i] = x[cells[i]];
-            Ax_local_[i] = y[cells[i]];
+            x_local[i] = x[cells[i]];
+            Ax_local[i] = y[cells[i]];
         }
 
-        well->apply(x_local_, Ax_local_);
+        well->apply(x_local, Ax_local);
 
         for (size_t i = 0; i < cells.size(); ++i) {
             // only need to update Ax
-            y[cells[i]] = Ax_local_[i];
+            y[cells[i]] = Ax_local[i];
         }
 
     }
@@ -169,6 +189,89 @@ protected:
     mutable X x_local_{};
     mutable Y Ax_local_{};
     mutable Y scaleAddRes_{};
+
+private:
+#ifdef _OPENMP
+    /// Apply the wells using all OpenMP threads. Wells sharing no
+    /// perforated cells are applied concurrently, one group of such
+    /// wells after the other.
+    void applyThreaded(const X& x, Y& y) const
+    {
+        this->updateWellGroups();
+
+        const auto wells = this->wellMod_.begin();
+
+        // Wells distributed over several processes communicate when
+        // applied, so they must be applied in the same order everywhere.
+        for (const auto wellIdx : distributedWells_) {
+            const auto& well = wells[wellIdx];
+            this->applySingleWell(x, y, well, well->cells(), x_local_, Ax_local_);
+        }
+
+        const int numThreads = omp_get_max_threads();
+        if (static_cast<int>(threadXLocal_.size()) < numThreads) {
+            threadXLocal_.resize(numThreads);
+            threadAxLocal_.resize(numThreads);
+        }
+        for (const auto& group : wellGroups_) {
+            const int numWells = group.size();
+#pragma omp parallel for schedule(dynamic, 1)
+            for (int i = 0; i < numWells; ++i) {
+                const int thread = omp_get_thread_num();
+                const auto& well = wells[group[i]];
+                this->applySingleWell(x, y, well, well->cells(),
+                                      threadXLocal_[thread], threadAxLocal_[thread]);
+            }
+        }
+    }
+
+    /// Set up distributedWells_ and wellGroups_, unless the well
+    /// container has not been rebuilt since they were set up.
+    void updateWellGroups() const
+    {
+        const std::size_t generation = this->wellMod_.wellContainerGeneration();
+        if (groupedGeneration_ == generation) {
+            return;
+        }
+
+        distributedWells_.clear();
+        wellGroups_.clear();
+        std::vector<std::unordered_set<int>> groupCells;
+        int wellIdx = 0;
+        for (const auto& well : this->wellMod_) {
+            const auto& cells = well->cells();
+            if (well->parallelWellInfo().communication().size() > 1) {
+                distributedWells_.push_back(wellIdx++);
+                continue;
+            }
+            // First group in which no other well perforates these cells.
+            std::size_t group = 0;
+            while (group < wellGroups_.size() &&
+                   std::any_of(cells.begin(), cells.end(),
+                               [&used = groupCells[group]](const int cell)
+                               { return used.count(cell) > 0; })) {
+                ++group;
+            }
+            if (group == wellGroups_.size()) {
+                wellGroups_.emplace_back();
+                groupCells.emplace_back();
+            }
+            wellGroups_[group].push_back(wellIdx++);
+            groupCells[group].insert(cells.begin(), cells.end());
+        }
+        groupedGeneration_ = generation;
+    }
+#endif
+
+    // Generation of the well container that wellGroups_ was set up for.
+    mutable std::optional<std::size_t> groupedGeneration_{};
+    // Indices of the wells distributed over several processes.
+    mutable std::vector<int> distributedWells_{};
+    // Groups of indices of wells not sharing any perforated cells.
+    mutable std::vector<std::vector<int>> wellGroups_{};
+    // Per thread scratch vectors for applyThreaded().
+    mutable std::vector<X> threadXLocal_{};
+    mutable std::vector<Y> threadAxLocal_{};
 };
 
 template <class WellModel, class X, class Y>
@@ -189,7 +292,8 @@ public:
         for (const auto& well : this->wellMod_) {
             if (this->wellMod_.well_domain().at(well->name()) == domainIndex_) {
                 this->applySingleWell(x, y, well,
-                                      this->wellMod_.well_local_cells()[well_index]);
+                                      this->wellMod_.well_local_cells()[well_index],
+                                      this->x_local_, this->Ax_local_);
             }
             ++well_index;
         }
@@ -13,6 +13,8 @@ bslv_memory *bslv_alloc()
     assert(mem);
     mem->e    = NULL;
     mem->dtmp = NULL;
+    mem->P    = NULL;
+    mem->comm = NULL;
     return mem;
 }
 
@@ -101,7 +103,54 @@ double __attribute__((noinline)) vec_inner2(const double *a, const double *b, in
     return agg[0];
 }
 
-int bslv_pbicgstab3m(bslv_memory *mem, bsr_matrix *A, const double *b, double *x)
+void bslv_set_comm(bslv_memory *mem, bslv_comm *comm)
+{
+    mem->comm = comm;
+}
+
+/**
+ * @brief Inner products of pairs of vectors over the owned entries.
+ *
+ * @note The local products are summed over all processes in a single
+ *       reduction for distributed-memory runs.
+ *
+ * @param mem Pointer to solver memory object.
+ * @param count Number of inner products.
+ * @param a First input vectors.
+ * @param b Second input vectors.
+ * @param result Inner products a[i].b[i].
+ */
+static void bslv_inner(bslv_memory *mem, int count, const double **a, const double **b, double *result)
+{
+    int n = mem->comm ? mem->comm->nowned : mem->n;
+    int m = 8*(n/8);
+    for(int i=0;i<count;i++)
+    {
+        result[i] = vec_inner2(a[i],b[i],m);
+        for(int k=m;k<n;k++) result[i]+=a[i][k]*b[i][k];
+    }
+    if(mem->comm) mem->comm->allreduce(mem->comm->ctx,result,count);
+}
+
+/**
+ * @brief Zero out ghost entries before applying the block-Jacobi preconditioner.
+ */
+static void bslv_project(bslv_memory *mem, double *x)
+{
+    if(mem->comm == NULL) return;
+    for(int k=mem->comm->nowned;k<mem->n;k++) x[k]=0.0;
+}
+
+/**
+ * @brief Update ghost entries before a matrix-vector product.
+ */
+static void bslv_exchange(bslv_memory *mem, double *x)
+{
+    if(mem->comm == NULL) return;
+    mem->comm->exchange(mem->comm->ctx,x);
+}
+
+int bslv_pbicgstabm(bslv_memory *mem, bsr_matrix *A, const double *b, double *x)
 {
 
     double tol = mem->tol;
@@ -128,52 +177,60 @@ int bslv_pbicgstab3m(bslv_memory *mem, bsr_matrix *A, const double *b, double *x
     vec_copy(p_j,b,n);
 
     vec_copy(q_j,p_j,n);
-    //double norm_0 = sqrt(vec_inner(r_j,r_j,n));
-    double norm_0 = sqrt(vec_inner2(r_j,r_j,n));
 
-    //double rho_j = vec_inner(r0,r_j,n);
-    double rho_j = vec_inner2(r0,r_j,n);
+    // inner products are fused pairwise to save global reductions
+    double dot[2];
+    bslv_inner(mem,2,(const double*[]){r_j,r0},(const double*[]){r_j,r_j},dot);
+    double norm_0 = sqrt(dot[0]);
+    double rho_j = dot[1];
     int j;
     for(j=0;j<max_iter;j++)
     {
         //vec_copy(q_j,p_j,n);                                        //q_j=p_j
-        prec_mapply3c(P,q_j);                                          //q_j=P.q_j;
-        bsr_vmspmv3(A,q_j,v_j);                                        //v_j= A.q_j
+        bslv_project(mem,q_j);
+        prec_mapply(P,q_j);                                            //q_j=P.q_j;
+        bslv_exchange(mem,q_j);
+        bsr_vmspmv(A,q_j,v_j);                                         //v_j= A.q_j
 
-        //double alpha_j = rho_j/vec_inner(r0,v_j,n);
-        double alpha_j = rho_j/vec_inner2(r0,v_j,n);
+        bslv_inner(mem,1,(const double*[]){r0},(const double*[]){v_j},dot);
+        double alpha_j = rho_j/dot[0];
         for (int k=0;k<n;k++) q_j[k] = s_j[k] = r_j[k]-alpha_j*v_j[k];       // r_j and s_j can overwrite each other
         //vec_axpy(-alpha_j,v_j,r_j,s_j,n);
 
         //vec_copy(q_j,s_j,n);                                        //q_j=s_j
-        prec_mapply3c(P,q_j);                                          //q_j=P.q_j;
-        bsr_vmspmv3(A,q_j,t_j);                                        //t_j= A.q_j
+        bslv_project(mem,q_j);
+        prec_mapply(P,q_j);                                            //q_j=P.q_j;
+        bslv_exchange(mem,q_j);
+        bsr_vmspmv(A,q_j,t_j);                                         //t_j= A.q_j
 
-        //double w_j = vec_inner(s_j,t_j,n)/vec_inner(t_j,t_j,n);
-        double w_j = vec_inner2(s_j,t_j,n)/vec_inner2(t_j,t_j,n);
+        bslv_inner(mem,2,(const double*[]){s_j,t_j},(const double*[]){t_j,t_j},dot);
+        double w_j = dot[0]/dot[1];
         for (int k=0;k<n;k++) x_j[k] += alpha_j*p_j[k] + w_j*s_j[k];
         for (int k=0;k<n;k++) r_j[k]  =         s_j[k] - w_j*t_j[k];
         //vec_axpy(-w_j,t_j,s_j,r_j,n);
-        //double norm_e = sqrt(vec_inner(r_j,r_j,n));
-        double norm_e = sqrt(vec_inner2(r_j,r_j,n));
+
+        // rho_j is computed together with the residual norm
+        bslv_inner(mem,2,(const double*[]){r_j,r0},(const double*[]){r_j,r_j},dot);
+        double norm_e = sqrt(dot[0]);
         e[j+1]=norm_e/norm_0;
 
         if (norm_e<tol*norm_0) break;                               //convergence check
 
         double rho_0 =rho_j;
-        //rho_j=vec_inner(r0,r_j,n);
-        rho_j=vec_inner2(r0,r_j,n);
+        rho_j=dot[1];
 
         double beta_j = (alpha_j/w_j)*(rho_j/rho_0);
         for (int k=0;k<n;k++) q_j[k] = p_j[k] = r_j[k] + beta_j*(p_j[k] - w_j*v_j[k]);
     }
-    prec_mapply3c(P,x_j);                                       //x_j=P.x_j;
+    bslv_project(mem,x_j);
+    prec_mapply(P,x_j);                                         //x_j=P.x_j;
+    bslv_exchange(mem,x_j);
 
     return j == max_iter ? j : ++j;
 }
 
 
-int bslv_pbicgstab3d(bslv_memory *mem, bsr_matrix *A, const double *b, double *x)
+int bslv_pbicgstabd(bslv_memory *mem, bsr_matrix *A, const double *b, double *x)
 {
 
     double tol = mem->tol;
@@ -200,46 +257,54 @@ int bslv_pbicgstab3d(bslv_memory *mem, bsr_matrix *A, const double *b, double *x
     vec_copy(p_j,b,n);
 
     vec_copy(q_j,p_j,n);
-    //double norm_0 = sqrt(vec_inner(r_j,r_j,n));
-    double norm_0 = sqrt(vec_inner2(r_j,r_j,n));
 
-    //double rho_j = vec_inner(r0,r_j,n);
-    double rho_j = vec_inner2(r0,r_j,n);
+    // inner products are fused pairwise to save global reductions
+    double dot[2];
+    bslv_inner(mem,2,(const double*[]){r_j,r0},(const double*[]){r_j,r_j},dot);
+    double norm_0 = sqrt(dot[0]);
+    double rho_j = dot[1];
     int j;
     for(j=0;j<max_iter;j++)
     {
         //vec_copy(q_j,p_j,n);                                        //q_j=p_j
-        prec_dapply3c(P,q_j);                                          //q_j=P.q_j;
-        bsr_vdspmv3(A,q_j,v_j);                                        //v_j= A.q_j
+        bslv_project(mem,q_j);
+        prec_dapply(P,q_j);                                            //q_j=P.q_j;
+        bslv_exchange(mem,q_j);
+        bsr_vdspmv(A,q_j,v_j);                                         //v_j= A.q_j
 
-        //double alpha_j = rho_j/vec_inner(r0,v_j,n);
-        double alpha_j = rho_j/vec_inner2(r0,v_j,n);
+        bslv_inner(mem,1,(const double*[]){r0},(const double*[]){v_j},dot);
+        double alpha_j = rho_j/dot[0];
         for (int k=0;k<n;k++) q_j[k] = s_j[k] = r_j[k]-alpha_j*v_j[k];       // r_j and s_j can overwrite each other
         //vec_axpy(-alpha_j,v_j,r_j,s_j,n);
 
         //vec_copy(q_j,s_j,n);                                        //q_j=s_j
-        prec_dapply3c(P,q_j);                                          //q_j=P.q_j;
-        bsr_vdspmv3(A,q_j,t_j);                                        //t_j= A.q_j
+        bslv_project(mem,q_j);
+        prec_dapply(P,q_j);                                            //q_j=P.q_j;
+        bslv_exchange(mem,q_j);
+        bsr_vdspmv(A,q_j,t_j);                                         //t_j= A.q_j
 
-        //double w_j = vec_inner(s_j,t_j,n)/vec_inner(t_j,t_j,n);
-        double w_j = vec_inner2(s_j,t_j,n)/vec_inner2(t_j,t_j,n);
+        bslv_inner(mem,2,(const double*[]){s_j,t_j},(const double*[]){t_j,t_j},dot);
+        double w_j = dot[0]/dot[1];
         for (int k=0;k<n;k++) x_j[k] += alpha_j*p_j[k] + w_j*s_j[k];
         for (int k=0;k<n;k++) r_j[k]  =         s_j[k] - w_j*t_j[k];
         //vec_axpy(-w_j,t_j,s_j,r_j,n);
-        //double norm_e = sqrt(vec_inner(r_j,r_j,n));
-        double norm_e = sqrt(vec_inner2(r_j,r_j,n));
+
+        // rho_j is computed together with the residual norm
+        bslv_inner(mem,2,(const double*[]){r_j,r0},(const double*[]){r_j,r_j},dot);
+        double norm_e = sqrt(dot[0]);
         e[j+1]=norm_e/norm_0;
 
         if (norm_e<tol*norm_0) break;                               //convergence check
 
         double rho_0 =rho_j;
-        //rho_j=vec_inner(r0,r_j,n);
-        rho_j=vec_inner2(r0,r_j,n);
+        rho_j=dot[1];
 
         double beta_j = (alpha_j/w_j)*(rho_j/rho_0);
         for (int k=0;k<n;k++) q_j[k] = p_j[k] = r_j[k] + beta_j*(p_j[k] - w_j*v_j[k]);
     }
-    prec_dapply3c(P,x_j);                                       //x_j=P.x_j;
+    bslv_project(mem,x_j);
+    prec_dapply(P,x_j);                                         //x_j=P.x_j;
+    bslv_exchange(mem,x_j);
 
     return j == max_iter ? j : ++j;
 }
@@ -10,6 +10,27 @@ extern "C" {
 
 #include <stdbool.h>
 
+/*!
+ * @brief Communication hooks for distributed-memory runs.
+ *
+ * The local vectors hold the owned entries first, followed by the ghost
+ * entries. Ghost rows of the local matrix are expected to be identity rows
+ * such that the local factorization is a block-Jacobi preconditioner.
+ */
+typedef
+struct bslv_comm
+{
+    // number of owned vector entries (owned rows times block size)
+    int nowned;
+    // opaque pointer passed to the callbacks
+    void *ctx;
+    // sum count values over all processes in place
+    void (*allreduce)(void *ctx, double *values, int count);
+    // copy owned entries of x to the matching ghost entries on other processes
+    void (*exchange)(void *ctx, double *x);
+}
+bslv_comm;
+
 /*!
  * @brief Linear solver memory.
  */
@@ -33,6 +54,9 @@ struct bslv_memory
 
     // pointer to preconditioner
     prec_t *P;
+
+    // communication hooks, NULL for serial runs
+    bslv_comm *comm;
 }
 bslv_memory;
 
@@ -69,6 +93,18 @@ void bslv_info(bslv_memory *mem, int count);
  */
 void bslv_init(bslv_memory *mem, double tol, int max_iter, bsr_matrix const *A, bool use_dilu);
 
+/**
+ * @brief Enable distributed-memory runs.
+ *
+ * @note Inner products are restricted to the owned entries and summed over
+ *       all processes, and ghost entries are updated before each matrix-vector
+ *       product. The hooks must outlive the solver memory object.
+ *
+ * @param mem Pointer to solver memory object.
+ * @param comm Pointer to communication hooks, or NULL for serial runs.
+ */
+void bslv_set_comm(bslv_memory *mem, bslv_comm *comm);
+
 /**
  * @brief Preconditioned bicgstab in mixed-precision.
  *
@@ -81,7 +117,7 @@ void bslv_init(bslv_memory *mem, double tol, int max_iter, bsr_matrix const *A,
  *
  * @return Number of linear iterations.
  */
-int  bslv_pbicgstab3m(bslv_memory *mem, bsr_matrix *A, const double *b, double *x);
+int  bslv_pbicgstabm(bslv_memory *mem, bsr_matrix *A, const double *b, double *x);
 
 /**
  * @brief Preconditioned bicgstab in double-precision.
@@ -95,7 +131,7 @@ int  bslv_pbicgstab3m(bslv_memory *mem, bsr_matrix *A, const double *b, double *
  *
  * @return Number of linear iterations.
  */
-int  bslv_pbicgstab3d(bslv_memory *mem, bsr_matrix *A, const double *b, double *x);
+int  bslv_pbicgstabd(bslv_memory *mem, bsr_matrix *A, const double *b, double *x);
 
 #ifdef __cplusplus
 }
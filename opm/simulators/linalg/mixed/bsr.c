@@ -40,6 +40,8 @@ void bsr_free(bsr_matrix *A)
 
 void bsr_init(bsr_matrix *A, int nrows, int nnz, int b)
 {
+    assert(b>0 && b<=BSR_MAX_BLOCK_SIZE);
+
     A->nrows=nrows;
     A->ncols=nrows;
     A->nnz=nnz;
@@ -70,6 +72,87 @@ void bsr_info(bsr_matrix *A)
     printf("\n");
 }
 
+/**
+ * @brief Sparse matrix-vector multiplication in mixed precision for general block sizes.
+ *
+ * @note Function is inlined into bsr_vmspmv such that the loops over
+ *       blocks are unrolled for each block size.
+ */
+static inline __attribute__((always_inline))
+void bsr_vmspmvb(bsr_matrix *A, const double *x, double *y, const int b)
+{
+    const int bb=b*b;
+    const int *rowptr=A->rowptr;
+    const int *colidx=A->colidx;
+    const float *data=A->flt;
+
+    for(int i=0;i<A->nrows;i++)
+    {
+        double z[BSR_MAX_BLOCK_SIZE];
+        for(int r=0;r<b;r++) z[r]=0.0;
+        for(int k=rowptr[i];k<rowptr[i+1];k++)
+        {
+            const float *AA=data+bb*k;
+            const double *xj=x+b*colidx[k];
+            for(int c=0;c<b;c++) for(int r=0;r<b;r++) z[r]+=AA[r+b*c]*xj[c];
+        }
+        for(int r=0;r<b;r++) y[b*i+r]=z[r];
+    }
+}
+
+/**
+ * @brief Sparse matrix-vector multiplication in double precision for general block sizes.
+ */
+static inline __attribute__((always_inline))
+void bsr_vdspmvb(bsr_matrix *A, const double *x, double *y, const int b)
+{
+    const int bb=b*b;
+    const int *rowptr=A->rowptr;
+    const int *colidx=A->colidx;
+    const double *data=A->dbl;
+
+    for(int i=0;i<A->nrows;i++)
+    {
+        double z[BSR_MAX_BLOCK_SIZE];
+        for(int r=0;r<b;r++) z[r]=0.0;
+        for(int k=rowptr[i];k<rowptr[i+1];k++)
+        {
+            const double *AA=data+bb*k;
+            const double *xj=x+b*colidx[k];
+            for(int c=0;c<b;c++) for(int r=0;r<b;r++) z[r]+=AA[r+b*c]*xj[c];
+        }
+        for(int r=0;r<b;r++) y[b*i+r]=z[r];
+    }
+}
+
+void bsr_vmspmv(bsr_matrix *A, const double *x, double *y)
+{
+    switch(A->b)
+    {
+        case 1: bsr_vmspmvb(A,x,y,1); break;
+        case 2: bsr_vmspmvb(A,x,y,2); break;
+        case 3: bsr_vmspmv3(A,x,y);   break;
+        case 4: bsr_vmspmvb(A,x,y,4); break;
+        case 5: bsr_vmspmvb(A,x,y,5); break;
+        case 6: bsr_vmspmvb(A,x,y,6); break;
+        default: assert(0);
+    }
+}
+
+void bsr_vdspmv(bsr_matrix *A, const double *x, double *y)
+{
+    switch(A->b)
+    {
+        case 1: bsr_vdspmvb(A,x,y,1); break;
+        case 2: bsr_vdspmvb(A,x,y,2); break;
+        case 3: bsr_vdspmv3(A,x,y);   break;
+        case 4: bsr_vdspmvb(A,x,y,4); break;
+        case 5: bsr_vdspmvb(A,x,y,5); break;
+        case 6: bsr_vdspmvb(A,x,y,6); break;
+        default: assert(0);
+    }
+}
+
 void bsr_vmspmv3(bsr_matrix *A, const double *x, double *y)
 {
     int nrows = A->nrows;
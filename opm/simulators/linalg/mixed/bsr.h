@@ -4,6 +4,9 @@
 extern "C" {
 #endif
 
+// largest supported block size
+#define BSR_MAX_BLOCK_SIZE 6
+
 /*!
  * @brief Mixed-precision bsr matrix.
  */
@@ -50,10 +53,34 @@ void bsr_free(bsr_matrix *A);
  * @param A Pointer to bsr matrix.
  * @param nrows Number of rows.
  * @apram nnz Number of nonzero blocks.
- * @param b Block size.
+ * @param b Block size, at most BSR_MAX_BLOCK_SIZE.
  */
 void bsr_init(bsr_matrix *A, int nrows, int nnz, int b);
 
+/**
+ * @brief Sparse matrix-vector multiplication in mixed precision.
+ *
+ * @note Function dispatches on the block size of A and uses
+ *       bsr_vmspmv3 for 3x3 block-sparse matrices.
+ *
+ * @param A Pointer to bsr matrix.
+ * @param x Pointer to input vector.
+ * @param y Pointer to output vector.
+ */
+void bsr_vmspmv(bsr_matrix *A, const double *x, double *y);
+
+/**
+ * @brief Sparse matrix-vector multiplication in double precision.
+ *
+ * @note Function dispatches on the block size of A and uses
+ *       bsr_vdspmv3 for 3x3 block-sparse matrices.
+ *
+ * @param A Pointer to bsr matrix.
+ * @param x Pointer to input vector.
+ * @param y Pointer to output vector.
+ */
+void bsr_vdspmv(bsr_matrix *A, const double *x, double *y);
+
 /**
  * @brief Sparse matrix-vector multiplication in mixed precision.
  *
@@ -1,6 +1,7 @@
 #include "prec.h"
 
 #include <stdio.h>
+#include <math.h>
 #include <assert.h>
 #include <immintrin.h>
 
@@ -314,6 +315,152 @@ void mat3_vfms(double *C, double const *A, double const *B)
     }
 }
 
+/**
+ * @brief Matrix inverse for bxb matrices.
+ *
+ * @note Gauss-Jordan elimination with partial pivoting.
+ *
+ * @param invA Pointer to inverse matrix.
+ * @param    A Pointer to input matrix.
+ * @param    b Block size.
+ */
+static void matb_inv(double *invA, const double *A, int b)
+{
+    // assume bxb column-major matrices
+    double M[BSR_MAX_BLOCK_SIZE*BSR_MAX_BLOCK_SIZE];
+    for(int k=0;k<b*b;k++) M[k]=A[k];
+    for(int k=0;k<b*b;k++) invA[k]=0.0;
+    for(int k=0;k<b;k++) invA[k+b*k]=1.0;
+
+    for(int c=0;c<b;c++)
+    {
+        // select pivot row
+        int p=c;
+        for(int r=c+1;r<b;r++) if(fabs(M[r+b*c])>fabs(M[p+b*c])) p=r;
+        if(p!=c)
+        {
+            for(int k=0;k<b;k++)
+            {
+                double t;
+                t=M[p+b*k];    M[p+b*k]=M[c+b*k];       M[c+b*k]=t;
+                t=invA[p+b*k]; invA[p+b*k]=invA[c+b*k]; invA[c+b*k]=t;
+            }
+        }
+
+        // normalize pivot row
+        double d=1.0/M[c+b*c];
+        for(int k=0;k<b;k++)
+        {
+            M[c+b*k]*=d;
+            invA[c+b*k]*=d;
+        }
+
+        // eliminate column c from remaining rows
+        for(int r=0;r<b;r++)
+        {
+            if(r==c) continue;
+            double f=M[r+b*c];
+            for(int k=0;k<b;k++)
+            {
+                M[r+b*k]-=f*M[c+b*k];
+                invA[r+b*k]-=f*invA[c+b*k];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Fused multiply-subtract for bxb matrices.
+ *
+ * @param C Pointer to output matrix.
+ * @param A Pointer to left input matrix.
+ * @param B Pointer to right input matrix.
+ * @param b Block size.
+ */
+static void matb_vfms(double *C, const double *A, const double *B, int b)
+{
+    // assume bxb column-major matrices that do not overlap
+    for(int j=0;j<b;j++)
+    {
+        double *c_j = C+b*j;            // j-th column of C
+        for(int k=0;k<b;k++)
+        {
+            double b_kj = B[k+b*j];     // kj-th element of B
+            double const *a_k = A+b*k;  // k-th column of A
+            for(int i=0;i<b;i++) c_j[i] -= a_k[i]*b_kj; // |c_j> -= |a_k> * b_kj;
+        }
+    }
+}
+
+/**
+ * @brief In-place right matrix-matrix multiplication for bxb matrices.
+ *
+ * @param A Pointer to left input and output matrix.
+ * @param B Pointer to right input matrix.
+ * @param b Block size.
+ */
+static void matb_rmul(double *A, double const *B, int b)
+{
+    double M[BSR_MAX_BLOCK_SIZE*BSR_MAX_BLOCK_SIZE];
+    for(int k=0;k<b*b;k++) M[k]=0.0;
+    matb_vfms(M,A,B,b);
+    for(int k=0;k<b*b;k++) A[k]=-M[k];
+}
+
+/**
+ * @brief In-place left matrix-matrix multiplication for bxb matrices.
+ *
+ * @param A Pointer to left input  matrix.
+ * @param B Pointer to right input and output matrix.
+ * @param b Block size.
+ */
+static void matb_lmul(double const *A, double *B, int b)
+{
+    double M[BSR_MAX_BLOCK_SIZE*BSR_MAX_BLOCK_SIZE];
+    for(int k=0;k<b*b;k++) M[k]=0.0;
+    matb_vfms(M,A,B,b);
+    for(int k=0;k<b*b;k++) B[k]=-M[k];
+}
+
+/**
+ * @brief Vector copy of block-sized vectors.
+ *
+ * @param y Pointer to output vector.
+ * @param x Pointer to input vector.
+ * @param n Number of elements.
+ */
+static inline void vec_copyb(double *y, double const *x, int n)
+{
+    for(int i=0;i<n;i++) y[i]=x[i];
+}
+
+/*
+ * Block operations used by the factorizations. The avx2 kernels
+ * are used for 3x3 blocks, the generic ones for all other sizes.
+ */
+static inline void blk_inv(double *invA, const double *A, int b)
+{
+    if(b==3) mat3_inv(invA,A);
+    else     matb_inv(invA,A,b);
+}
+
+static inline void blk_rmul(double *A, double const *B, int b)
+{
+    if(b==3) mat3_rmul(A,B);
+    else     matb_rmul(A,B,b);
+}
+
+static inline void blk_lmul(double const *A, double *B, int b)
+{
+    if(b==3) mat3_lmul(A,B);
+    else     matb_lmul(A,B,b);
+}
+
+static inline void blk_vfms(double *C, double const *A, double const *B, int b)
+{
+    if(b==3) mat3_vfms(C,A,B);
+    else     matb_vfms(C,A,B,b);
+}
 
 void prec_dilu_factorize(prec_t *P, bsr_matrix *A)
 {
@@ -335,16 +482,16 @@ void prec_dilu_factorize(prec_t *P, bsr_matrix *A)
             if(j<i)       // struct-transpose of L
             {
                 int kL = L->rowptr[j];
-                vec_copy9(L->dbl + bb*kL, A->dbl + bb*k);
+                vec_copyb(L->dbl + bb*kL, A->dbl + bb*k, bb);
                 L->rowptr[j]++;
             }
             else if(j==i) // struct-copy of D
             {
-                vec_copy9(D->dbl + bb*i, A->dbl + bb*k);
+                vec_copyb(D->dbl + bb*i, A->dbl + bb*k, bb);
             }
             else if(j>i) // struct-copy of U
             {
-                vec_copy9(U->dbl + bb*kU, A->dbl + bb*k);
+                vec_copyb(U->dbl + bb*kU, A->dbl + bb*k, bb);
                 kU++;
             }
         }
@@ -354,22 +501,22 @@ void prec_dilu_factorize(prec_t *P, bsr_matrix *A)
     L->rowptr[0]=0;
 
     // Factorizing
-    double scale[9]; //hard-coded to 3x3 blocks for now
+    double scale[BSR_MAX_BLOCK_SIZE*BSR_MAX_BLOCK_SIZE];
     for(int i=0;i<A->nrows;i++)
     {
-        mat3_inv(scale,D->dbl+i*bb);
-        vec_copy9(D->dbl+bb*i, scale); //store inverse instead to simplify application
+        blk_inv(scale,D->dbl+i*bb,b);
+        vec_copyb(D->dbl+bb*i, scale, bb); //store inverse instead to simplify application
         for(int k=L->rowptr[i];k<L->rowptr[i+1];k++)
         {
             //scale column i of L
-            mat3_rmul(L->dbl+k*bb,scale);
+            blk_rmul(L->dbl+k*bb,scale,b);
 
             //update diagonal of U
             int j=L->colidx[k];
-            mat3_vfms(D->dbl+j*bb,L->dbl+k*bb,U->dbl+k*bb);
+            blk_vfms(D->dbl+j*bb,L->dbl+k*bb,U->dbl+k*bb,b);
 
             //scale row i of U
-            mat3_lmul(scale,U->dbl+k*bb);
+            blk_lmul(scale,U->dbl+k*bb,b);
 
             //NOT IMPLEMENTED!
             for(int m=L->rowptr[j];m<L->rowptr[j+1];m++)
@@ -405,16 +552,16 @@ void prec_ilu0_factorize(prec_t *P, bsr_matrix *A)
             if(j<i)       // struct-transpose of L
             {
                 int kL = L->rowptr[j];
-                vec_copy9(L->dbl + bb*kL, A->dbl + bb*k);
+                vec_copyb(L->dbl + bb*kL, A->dbl + bb*k, bb);
                 L->rowptr[j]++;
             }
             else if(j==i) // struct-copy of D
             {
-                vec_copy9(D->dbl + bb*i, A->dbl + bb*k);
+                vec_copyb(D->dbl + bb*i, A->dbl + bb*k, bb);
             }
             else if(j>i) // struct-copy of U
             {
-                vec_copy9(U->dbl + bb*kU, A->dbl + bb*k);
+                vec_copyb(U->dbl + bb*kU, A->dbl + bb*k, bb);
                 kU++;
             }
         }
@@ -426,19 +573,19 @@ void prec_ilu0_factorize(prec_t *P, bsr_matrix *A)
     // Factorizing
     int idx=0;
     int next = P->offsets[idx][0];
-    double scale[9]; //hard-coded to 3x3 blocks for now
+    double scale[BSR_MAX_BLOCK_SIZE*BSR_MAX_BLOCK_SIZE];
     for(int i=0;i<A->nrows;i++)
     {
-        mat3_inv(scale,D->dbl+i*bb);
-        vec_copy9(D->dbl+bb*i, scale); //store inverse instead to simplify application
+        blk_inv(scale,D->dbl+i*bb,b);
+        vec_copyb(D->dbl+bb*i, scale, bb); //store inverse instead to simplify application
         for(int k=L->rowptr[i];k<L->rowptr[i+1];k++)
         {
             //scale column i of L
-            mat3_rmul(L->dbl+k*bb,scale);
+            blk_rmul(L->dbl+k*bb,scale,b);
 
             //update diagonal D
             int j=L->colidx[k];
-            mat3_vfms(D->dbl+j*bb,L->dbl+k*bb,U->dbl+k*bb);
+            blk_vfms(D->dbl+j*bb,L->dbl+k*bb,U->dbl+k*bb,b);
         }
 
         while(next<U->rowptr[i+1])
@@ -448,8 +595,8 @@ void prec_ilu0_factorize(prec_t *P, bsr_matrix *A)
             int jk = P->offsets[idx][2];
 
             //update off-diagonals L and U
-            mat3_vfms(U->dbl+jk*bb,L->dbl+ij*bb,U->dbl+ik*bb);
-            mat3_vfms(L->dbl+jk*bb,L->dbl+ik*bb,U->dbl+ij*bb);
+            blk_vfms(U->dbl+jk*bb,L->dbl+ij*bb,U->dbl+ik*bb,b);
+            blk_vfms(L->dbl+jk*bb,L->dbl+ik*bb,U->dbl+ij*bb,b);
 
             //update marker
             next=P->offsets[++idx][0];
@@ -458,7 +605,7 @@ void prec_ilu0_factorize(prec_t *P, bsr_matrix *A)
         for(int k=L->rowptr[i];k<L->rowptr[i+1];k++)
         {
             //scale row i of U
-            mat3_lmul(scale,U->dbl+k*bb);
+            blk_lmul(scale,U->dbl+k*bb,b);
         }
 
     }
@@ -510,6 +657,135 @@ static inline void mat3_vecfms(double *y, const double *A, const double *x)
 }
 #endif
 
+/**
+ * @brief Preconditioner application in mixed-precision for general block sizes.
+ *
+ * @note Function is inlined into prec_mapply such that the loops over
+ *       blocks are unrolled for each block size.
+ */
+static inline __attribute__((always_inline))
+void prec_mapplyb(prec_t *restrict P, double *x, const int b)
+{
+    bsr_matrix *L  = P->L;
+    bsr_matrix *D  = P->D;
+    bsr_matrix *U  = P->U;
+
+    const int bb=b*b;
+
+    // Lower triangular solve assuming ones on diagonal
+    for(int i=0;i<L->ncols;i++)
+    {
+        double *xi = x+b*i;
+        double vx[BSR_MAX_BLOCK_SIZE];
+        for(int r=0;r<b;r++) vx[r]=xi[r];
+        for(int k=L->rowptr[i];k<L->rowptr[i+1];k++)
+        {
+            const float *A = L->flt+k*bb;
+            double *xj = x+b*U->colidx[k];
+            for(int c=0;c<b;c++) for(int r=0;r<b;r++) xj[r]-=A[r+b*c]*vx[c];
+        }
+
+        // Muliply by (inverse) diagonal block
+        const float *A = D->flt+i*bb;
+        double z[BSR_MAX_BLOCK_SIZE];
+        for(int r=0;r<b;r++) z[r]=0.0;
+        for(int c=0;c<b;c++) for(int r=0;r<b;r++) z[r]+=A[r+b*c]*vx[c];
+        for(int r=0;r<b;r++) xi[r]=z[r];
+    }
+
+    // Upper triangular solve assuming nonzeros stored in original order
+    for(int i=U->ncols;i>0;i--)
+    {
+        double z[BSR_MAX_BLOCK_SIZE];
+        for(int r=0;r<b;r++) z[r]=0.0;
+        for(int k=U->rowptr[i]-1;k>U->rowptr[i-1]-1;k--)
+        {
+            const float *A = U->flt+k*bb;
+            const double *xj = x+b*U->colidx[k];
+            for(int c=0;c<b;c++) for(int r=0;r<b;r++) z[r]+=A[r+b*c]*xj[c];
+        }
+        double *xi = x+b*(i-1);
+        for(int r=0;r<b;r++) xi[r]-=z[r];
+    }
+}
+
+/**
+ * @brief Preconditioner application in double-precision for general block sizes.
+ */
+static inline __attribute__((always_inline))
+void prec_dapplyb(prec_t *restrict P, double *x, const int b)
+{
+    bsr_matrix *L  = P->L;
+    bsr_matrix *D  = P->D;
+    bsr_matrix *U  = P->U;
+
+    const int bb=b*b;
+
+    // Lower triangular solve assuming ones on diagonal
+    for(int i=0;i<L->ncols;i++)
+    {
+        double *xi = x+b*i;
+        double vx[BSR_MAX_BLOCK_SIZE];
+        for(int r=0;r<b;r++) vx[r]=xi[r];
+        for(int k=L->rowptr[i];k<L->rowptr[i+1];k++)
+        {
+            const double *A = L->dbl+k*bb;
+            double *xj = x+b*U->colidx[k];
+            for(int c=0;c<b;c++) for(int r=0;r<b;r++) xj[r]-=A[r+b*c]*vx[c];
+        }
+
+        // Muliply by (inverse) diagonal block
+        const double *A = D->dbl+i*bb;
+        double z[BSR_MAX_BLOCK_SIZE];
+        for(int r=0;r<b;r++) z[r]=0.0;
+        for(int c=0;c<b;c++) for(int r=0;r<b;r++) z[r]+=A[r+b*c]*vx[c];
+        for(int r=0;r<b;r++) xi[r]=z[r];
+    }
+
+    // Upper triangular solve assuming nonzeros stored in original order
+    for(int i=U->ncols;i>0;i--)
+    {
+        double z[BSR_MAX_BLOCK_SIZE];
+        for(int r=0;r<b;r++) z[r]=0.0;
+        for(int k=U->rowptr[i]-1;k>U->rowptr[i-1]-1;k--)
+        {
+            const double *A = U->dbl+k*bb;
+            const double *xj = x+b*U->colidx[k];
+            for(int c=0;c<b;c++) for(int r=0;r<b;r++) z[r]+=A[r+b*c]*xj[c];
+        }
+        double *xi = x+b*(i-1);
+        for(int r=0;r<b;r++) xi[r]-=z[r];
+    }
+}
+
+void prec_mapply(prec_t *P, double *x)
+{
+    switch(P->D->b)
+    {
+        case 1: prec_mapplyb(P,x,1); break;
+        case 2: prec_mapplyb(P,x,2); break;
+        case 3: prec_mapply3c(P,x);  break;
+        case 4: prec_mapplyb(P,x,4); break;
+        case 5: prec_mapplyb(P,x,5); break;
+        case 6: prec_mapplyb(P,x,6); break;
+        default: assert(0);
+    }
+}
+
+void prec_dapply(prec_t *P, double *x)
+{
+    switch(P->D->b)
+    {
+        case 1: prec_dapplyb(P,x,1); break;
+        case 2: prec_dapplyb(P,x,2); break;
+        case 3: prec_dapply3c(P,x);  break;
+        case 4: prec_dapplyb(P,x,4); break;
+        case 5: prec_dapplyb(P,x,5); break;
+        case 6: prec_dapplyb(P,x,6); break;
+        default: assert(0);
+    }
+}
+
 void prec_mapply3c(prec_t *restrict P, double *x)
 {
     bsr_matrix *L  = P->L;
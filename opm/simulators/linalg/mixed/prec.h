@@ -73,10 +73,33 @@ void prec_dilu_factorize(prec_t *P, bsr_matrix *A);
  */
 void prec_ilu0_factorize(prec_t *P, bsr_matrix *A);
 
+/**
+ * @brief Preconditioner application in mixed-precision.
+ *
+ * @note Function dispatches on the block size of the factors and uses
+ *       prec_mapply3c for 3x3 blocks.
+ *
+ * @param P Pointer to preconditioner object.
+ * @apram x Pointer to input/output vector
+ */
+void prec_mapply(prec_t *P, double *x);
+
+/**
+ * @brief Preconditioner application in double-precision.
+ *
+ * @note Function dispatches on the block size of the factors and uses
+ *       prec_dapply3c for 3x3 blocks.
+ *
+ * @param P Pointer to preconditioner object.
+ * @apram x Pointer to input/output vector
+ */
+void prec_dapply(prec_t *P, double *x);
+
 /**
  * @brief Preconditioner application in mixed-precision.
  *
  * @note Algorithm onsists of lower and upper triangular solves
+ * @note Function is specialized for 3x3 blocks.
  *
  * @param P Pointer to preconditioner object.
  * @apram x Pointer to input/output vector
@@ -87,6 +110,7 @@ void prec_mapply3c(prec_t *P, double *x);
  * @brief Preconditioner applicationin double-precision.
  *
  * @note Algorithm onsists of lower and upper triangular solves
+ * @note Function is specialized for 3x3 blocks.
  *
  * @param P Pointer to preconditioner object.
  * @apram x Pointer to input/output vector
@@ -1,20 +1,162 @@
 #ifndef OPM_MIXED_SOLVER_HEADER_INCLUDED
 #define OPM_MIXED_SOLVER_HEADER_INCLUDED
 
+#include <opm/common/ErrorMacros.hpp>
+
 #include <opm/simulators/flow/BlackoilModelParameters.hpp>
 #include <opm/simulators/linalg/FlowLinearSolverParameters.hpp>
 
+#include <dune/istl/solvercategory.hh>
+#include <dune/istl/paamg/pinfo.hh>
+
+#if HAVE_MPI
+#include <dune/common/parallel/communicator.hh>
+#include <dune/common/parallel/interface.hh>
+#include <dune/istl/owneroverlapcopy.hh>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
 #include "bsr.h"
 #include "bslv.h"
 
 namespace Dune
 {
-template <class X, class M>
+
+#if HAVE_MPI
+namespace MixedDetail
+{
+// Raw view of the solver work vectors for use with the BufferedCommunicator.
+template <int b>
+struct HaloVector
+{
+    using value_type = FieldVector<double,b>;
+    double *data;
+};
+
+struct HaloCopy
+{
+    template <int b>
+    static FieldVector<double,b> gather(const HaloVector<b>& v, std::size_t i)
+    {
+        FieldVector<double,b> item;
+        std::copy_n(v.data + b*i, b, item.begin());
+        return item;
+    }
+
+    template <int b>
+    static void scatter(HaloVector<b>& v, const FieldVector<double,b>& item, std::size_t i)
+    {
+        std::copy_n(item.begin(), b, v.data + b*i);
+    }
+};
+} // namespace MixedDetail
+#endif
+
+template <class X, class M, class Comm = Amg::SequentialInformation>
 class MixedSolver : public InverseOperator<X,X>
 {
+    static constexpr bool isParallel = !std::is_same_v<Comm, Amg::SequentialInformation>;
+    static constexpr int blockSize = std::decay_t<M>::block_type::rows;
+
     public:
 
     MixedSolver(const M &A, double tol, int maxiter, bool use_dilu)
+    {
+        init(A, tol, maxiter, use_dilu);
+    }
+
+    // The owned rows must come first, which is checked, and ghost rows must
+    // have been replaced by identity rows, i.e. the local factorization is
+    // block-Jacobi.
+    MixedSolver(const M &A, double tol, int maxiter, bool use_dilu, const Comm& comm)
+    {
+        init(A, tol, maxiter, use_dilu);
+#if HAVE_MPI
+        if constexpr (isParallel) {
+            comm_ = &comm;
+
+            // the local solver only sees the first nowned rows as owned,
+            // so the owners must be exactly the rows [0, nowned)
+            std::size_t nowned = 0;
+            std::size_t owner_count = 0;
+            for (const auto& idx : comm.indexSet()) {
+                if (idx.local().attribute() == OwnerOverlapCopyAttributeSet::owner) {
+                    ++owner_count;
+                    nowned = std::max(nowned, static_cast<std::size_t>(idx.local().local()) + 1);
+                }
+            }
+            if (nowned != owner_count) {
+                OPM_THROW(std::logic_error, "The parallel mixed precision solver requires the owned "
+                          "rows to be numbered before the ghost rows. Use another linear solver.");
+            }
+
+            using AttributeSet = OwnerOverlapCopyAttributeSet::AttributeSet;
+            using OwnerSet = EnumItem<AttributeSet, OwnerOverlapCopyAttributeSet::owner>;
+            interface_.build(comm.remoteIndices(), OwnerSet(), AllSet<AttributeSet>());
+            communicator_.template build<MixedDetail::HaloVector<blockSize>>(interface_);
+
+            hooks_.nowned    = static_cast<int>(nowned) * jacobian_->b;
+            hooks_.ctx       = this;
+            hooks_.allreduce = &MixedSolver::allreduce;
+            hooks_.exchange  = &MixedSolver::exchange;
+            bslv_set_comm(mem_, &hooks_);
+        }
+#else
+        static_cast<void>(comm);
+#endif
+    }
+
+    ~MixedSolver()
+    {
+        bsr_free(jacobian_);
+        bslv_free(mem_);
+    }
+
+    virtual void apply (X& x, X& b, InverseOperatorResult& res) override
+    {
+        // transpose each dense block to make them column-major
+        constexpr int bs = blockSize;
+        constexpr int bb = bs*bs;
+        double B[bb];
+        for(int k=0;k<jacobian_->nnz;k++)
+        {
+            for(int i=0;i<bs;i++) for(int j=0;j<bs;j++) B[bs*j+i] = data_[bb*k + bs*i + j];
+            for(int i=0;i<bb;i++) jacobian_->dbl[bb*k + i] = B[i];
+        }
+
+        // downcast to allow mixed precision
+        bsr_downcast(jacobian_);
+
+        // solve linear system
+        int count = bslv_pbicgstabm(mem_, jacobian_, &b[0][0], &x[0][0]);
+        //int count = bslv_pbicgstabd(mem_, jacobian_, &b[0][0], &x[0][0]);
+
+        // return convergence information
+        res.converged  = (mem_->e[count] < mem_->tol);
+        res.reduction  = mem_->e[count];
+        res.iterations = count;
+    }
+
+    virtual void apply (X& x, X& b, double reduction, InverseOperatorResult& res) override
+    {
+        x=0;
+        b=0;
+        res.reduction = reduction;
+        OPM_THROW(std::invalid_argument, "MixedSolver::apply(...) not implemented yet.");
+
+    }
+
+    virtual Dune::SolverCategory::Category category() const override
+    {
+        return isParallel ? SolverCategory::overlapping : SolverCategory::sequential;
+    }
+
+    private:
+    void init(const M &A, double tol, int maxiter, bool use_dilu)
     {
         // verify that well contributions are added to the matrix
         if (!Opm::Parameters::Get<Opm::Parameters::MatrixAddWellContributions>()) {
@@ -23,10 +165,10 @@ class MixedSolver : public InverseOperator<X,X>
 
         int nrows = A.N();
         int nnz   = A.nonzeroes();
-        int b     = A[0][0].N();
+        int b     = blockSize;
 
-        // verify that block size is 3x3
-        if (b!=3) {OPM_THROW(std::logic_error, "Block sizes other than 3x3 are not supported by mixed precision.");}
+        // verify that block size is supported by the kernels
+        if (b>BSR_MAX_BLOCK_SIZE) {OPM_THROW(std::logic_error, "Block sizes larger than 6x6 are not supported by mixed precision.");}
 
         // create jacobian matrix object and allocate various arrays
         jacobian_ = bsr_alloc();
@@ -57,51 +199,30 @@ class MixedSolver : public InverseOperator<X,X>
         data_ = &A[0][0][0][0];
     }
 
-    ~MixedSolver()
-    {
-        bsr_free(jacobian_);
-        bslv_free(mem_);
-
-    }
-
-    virtual void apply (X& x, X& b, InverseOperatorResult& res) override
+#if HAVE_MPI
+    static void allreduce(void *ctx, double *values, int count)
     {
-        // transpose each dense block to make them column-major
-        double B[9];
-        for(int k=0;k<jacobian_->nnz;k++)
-        {
-            for(int i=0;i<3;i++) for(int j=0;j<3;j++) B[3*j+i] = data_[9*k + 3*i + j];
-            for(int i=0;i<9;i++) jacobian_->dbl[9*k + i] = B[i];
-        }
-
-        // downcast to allow mixed precision
-        bsr_downcast(jacobian_);
-
-        // solve linear system
-        int count = bslv_pbicgstab3m(mem_, jacobian_, &b[0][0], &x[0][0]);
-        //int count = bslv_pbicgstab3d(mem_, jacobian_, &b[0][0], &x[0][0]);
-
-        // return convergence information
-        res.converged  = (mem_->e[count] < mem_->tol);
-        res.reduction  = mem_->e[count];
-        res.iterations = count;
+        static_cast<MixedSolver*>(ctx)->comm_->communicator().sum(values, count);
     }
 
-    virtual void apply (X& x, X& b, double reduction, InverseOperatorResult& res) override
+    static void exchange(void *ctx, double *x)
     {
-        x=0;
-        b=0;
-        res.reduction = reduction;
-        OPM_THROW(std::invalid_argument, "MixedSolver::apply(...) not implemented yet.");
-
+        auto *self = static_cast<MixedSolver*>(ctx);
+        MixedDetail::HaloVector<blockSize> v{x};
+        self->communicator_.template forward<MixedDetail::HaloCopy>(v, v);
     }
+#endif
 
-    virtual Dune::SolverCategory::Category category() const override { return Dune::SolverCategory::sequential; };
-
-    private:
     bsr_matrix  *jacobian_;
     bslv_memory *mem_;
     double const *data_;
+
+    bslv_comm hooks_{};
+#if HAVE_MPI
+    const Comm *comm_ = nullptr;
+    Interface interface_;
+    BufferedCommunicator communicator_;
+#endif
 };
 
 }
@@ -0,0 +1,302 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <config.h>
+#include <opm/simulators/utils/DeckCache.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/common/TimingMacros.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/TransMult.hpp>
+#include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
+
+#include <opm/input/eclipse/Schedule/Action/Actions.hpp>
+#include <opm/input/eclipse/Schedule/Action/ASTNode.hpp>
+#include <opm/input/eclipse/Schedule/Action/State.hpp>
+#include <opm/input/eclipse/Schedule/GasLiftOpt.hpp>
+#include <opm/input/eclipse/Schedule/Group/GConSale.hpp>
+#include <opm/input/eclipse/Schedule/Group/GConSump.hpp>
+#include <opm/input/eclipse/Schedule/Group/GroupEconProductionLimits.hpp>
+#include <opm/input/eclipse/Schedule/Group/GroupSatelliteInjection.hpp>
+#include <opm/input/eclipse/Schedule/Group/GSatProd.hpp>
+#include <opm/input/eclipse/Schedule/Group/GuideRateConfig.hpp>
+#include <opm/input/eclipse/Schedule/MSW/SICD.hpp>
+#include <opm/input/eclipse/Schedule/MSW/Valve.hpp>
+#include <opm/input/eclipse/Schedule/MSW/WellSegments.hpp>
+#include <opm/input/eclipse/Schedule/Network/Balance.hpp>
+#include <opm/input/eclipse/Schedule/Network/ExtNetwork.hpp>
+#include <opm/input/eclipse/Schedule/ResCoup/ReservoirCouplingInfo.hpp>
+#include <opm/input/eclipse/Schedule/RFTConfig.hpp>
+#include <opm/input/eclipse/Schedule/RPTConfig.hpp>
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQActive.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
+#include <opm/input/eclipse/Schedule/Well/NameOrder.hpp>
+#include <opm/input/eclipse/Schedule/Well/WDFAC.hpp>
+#include <opm/input/eclipse/Schedule/Well/Well.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellBrineProperties.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellEconProductionLimits.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellFoamProperties.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellFractureSeeds.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellMICPProperties.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellPolymerProperties.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTestConfig.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTestState.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTracerProperties.hpp>
+#include <opm/input/eclipse/Schedule/Well/WList.hpp>
+#include <opm/input/eclipse/Schedule/Well/WListManager.hpp>
+#include <opm/input/eclipse/Schedule/Well/WVFPDP.hpp>
+#include <opm/input/eclipse/Schedule/Well/WVFPEXP.hpp>
+
+#include <fmt/format.h>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <system_error>
+
+namespace {
+
+constexpr std::array<char, 8> cacheMagic{'O', 'P', 'M', 'D', 'C', 'K', '0', '1'};
+constexpr std::size_t numRecords = 2;
+
+struct CacheHeader
+{
+    std::string fingerprint;
+    std::array<std::uint64_t, numRecords> recordSizes{};
+    std::streamoff dataStart{};
+};
+
+template<class T>
+bool readValue(std::istream& is, T& value)
+{
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+template<class T>
+void writeValue(std::ostream& os, const T& value)
+{
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// Sizes read from the file are checked against the file size before they
+// are used, so a truncated or corrupt cache is rejected instead of causing
+// huge allocations.
+std::optional<CacheHeader> readHeader(std::istream& is)
+{
+    if (!is.seekg(0, std::ios::end)) {
+        return std::nullopt;
+    }
+    const std::uint64_t fileSize = is.tellg();
+    is.seekg(0);
+
+    std::array<char, cacheMagic.size()> magic{};
+    if (!is.read(magic.data(), magic.size()) || magic != cacheMagic) {
+        return std::nullopt;
+    }
+
+    CacheHeader header;
+    std::uint64_t fingerprintSize = 0;
+    if (!readValue(is, fingerprintSize) ||
+        fingerprintSize > fileSize - static_cast<std::uint64_t>(is.tellg()))
+    {
+        return std::nullopt;
+    }
+    header.fingerprint.resize(fingerprintSize);
+    if (!is.read(header.fingerprint.data(), fingerprintSize)) {
+        return std::nullopt;
+    }
+    for (auto& size : header.recordSizes) {
+        if (!readValue(is, size)) {
+            return std::nullopt;
+        }
+    }
+    header.dataStart = is.tellg();
+
+    // The records must fill the rest of the file exactly.
+    std::uint64_t remaining = fileSize - static_cast<std::uint64_t>(header.dataStart);
+    for (const auto size : header.recordSizes) {
+        if (size > remaining) {
+            return std::nullopt;
+        }
+        remaining -= size;
+    }
+    if (remaining != 0) {
+        return std::nullopt;
+    }
+
+    return header;
+}
+
+} // Anonymous namespace
+
+namespace Opm {
+
+DeckCache::DeckCache(const std::string& fileName,
+                     const std::string& fingerprint)
+    : Serializer<Serialization::MemPacker>(m_packer_priv)
+    , m_fileName(fileName)
+    , m_fingerprint(fingerprint)
+{}
+
+std::string DeckCache::makeFingerprint(const Deck& deck,
+                                       const std::vector<std::string>& options)
+{
+    // The main deck file and all included files which contributed keywords.
+    std::set<std::string> files;
+    if (!deck.getDataFile().empty()) {
+        files.insert(deck.getDataFile());
+    }
+    for (const auto& keyword : deck) {
+        files.insert(keyword.location().filename);
+    }
+
+    // Errors are not reported here, they lead to a fingerprint which does
+    // not match any cache.
+    std::string fingerprint;
+    for (const auto& file : files) {
+        std::error_code ec;
+        const auto path = std::filesystem::weakly_canonical(file, ec);
+        const auto size = std::filesystem::file_size(path, ec);
+        const auto mtime = std::filesystem::last_write_time(path, ec).time_since_epoch().count();
+        fingerprint += fmt::format("file={};size={};mtime={};",
+                                   path.generic_string(), size, mtime);
+    }
+    for (const auto& option : options) {
+        fingerprint += option;
+        fingerprint += ';';
+    }
+
+    return fingerprint;
+}
+
+bool DeckCache::valid() const
+{
+    std::ifstream is(m_fileName, std::ios::binary);
+    if (!is) {
+        return false;
+    }
+
+    // readHeader() rejects truncated files.
+    const auto header = readHeader(is);
+    return header.has_value() && header->fingerprint == m_fingerprint;
+}
+
+void DeckCache::write(EclipseState& eclState,
+                      Schedule& schedule,
+                      SummaryConfig& summaryConfig,
+                      UDQState& udqState,
+                      Action::State& actionState,
+                      WellTestState& wtestState)
+{
+    OPM_TIMEFUNCTION();
+
+    const auto tmpName = m_fileName + ".tmp";
+    {
+        std::ofstream os(tmpName, std::ios::binary | std::ios::trunc);
+        if (!os) {
+            OPM_THROW(std::runtime_error,
+                      fmt::format("Could not open deck cache file {} for writing", tmpName));
+        }
+
+        os.write(cacheMagic.data(), cacheMagic.size());
+        writeValue(os, static_cast<std::uint64_t>(m_fingerprint.size()));
+        os.write(m_fingerprint.data(), m_fingerprint.size());
+
+        // The record sizes are filled in once the records have been packed.
+        const auto sizesPos = os.tellp();
+        std::array<std::uint64_t, numRecords> recordSizes{};
+        for (const auto size : recordSizes) {
+            writeValue(os, size);
+        }
+
+        this->pack(eclState);
+        recordSizes[0] = m_packSize;
+        os.write(m_buffer.data(), m_packSize);
+
+        this->pack(schedule, summaryConfig, udqState, actionState, wtestState);
+        recordSizes[1] = m_packSize;
+        os.write(m_buffer.data(), m_packSize);
+
+        os.seekp(sizesPos);
+        for (const auto size : recordSizes) {
+            writeValue(os, size);
+        }
+
+        if (!os.flush()) {
+            OPM_THROW(std::runtime_error,
+                      fmt::format("Error writing deck cache file {}", tmpName));
+        }
+    }
+
+    std::filesystem::rename(tmpName, m_fileName);
+}
+
+void DeckCache::readEclipseState(EclipseState& eclState)
+{
+    OPM_TIMEFUNCTION();
+    this->readRecord_(0);
+    this->unpack(eclState);
+}
+
+void DeckCache::readDynamicState(Schedule& schedule,
+                                 SummaryConfig& summaryConfig,
+                                 UDQState& udqState,
+                                 Action::State& actionState,
+                                 WellTestState& wtestState)
+{
+    OPM_TIMEFUNCTION();
+    this->readRecord_(1);
+    this->unpack(schedule, summaryConfig, udqState, actionState, wtestState);
+}
+
+void DeckCache::readRecord_(const std::size_t idx)
+{
+    std::ifstream is(m_fileName, std::ios::binary);
+    const auto header = is ? readHeader(is) : std::nullopt;
+    if (!header.has_value() ||
+        (!m_fingerprint.empty() && header->fingerprint != m_fingerprint))
+    {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Deck cache file {} is missing or does not match the deck", m_fileName));
+    }
+
+    std::streamoff offset = header->dataStart;
+    for (std::size_t i = 0; i < idx; ++i) {
+        offset += header->recordSizes[i];
+    }
+
+    // The whole record is read in one go, deserialization then works on memory.
+    m_packSize = header->recordSizes[idx];
+    m_buffer.resize(m_packSize);
+    if (!is.seekg(offset) || !is.read(m_buffer.data(), m_packSize)) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Error reading deck cache file {}", m_fileName));
+    }
+}
+
+} // namespace Opm
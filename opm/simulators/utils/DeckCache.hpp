@@ -0,0 +1,105 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_DECK_CACHE_HPP
+#define OPM_DECK_CACHE_HPP
+
+#include <opm/common/utility/Serializer.hpp>
+
+#include <opm/simulators/utils/SerializationPackers.hpp>
+
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+class Deck;
+class EclipseState;
+class Schedule;
+class SummaryConfig;
+class UDQState;
+class WellTestState;
+
+namespace Action {
+class State;
+}
+
+//! \brief Binary cache of the state objects created from an input deck.
+//!
+//! The file holds two records. The first one is the serialized EclipseState
+//! as it is broadcast to the non-I/O ranks, the second one holds the Schedule,
+//! SummaryConfig and the dynamic state objects. The file starts with a
+//! fingerprint of the deck files and the options used to process it; a cache
+//! with a different fingerprint is ignored.
+class DeckCache : public Serializer<Serialization::MemPacker> {
+public:
+    //! \brief Constructor.
+    //! \param fileName Name of cache file
+    //! \param fingerprint Fingerprint of the deck, see makeFingerprint().
+    //!                    If empty, the fingerprint stored in the file is not checked.
+    DeckCache(const std::string& fileName,
+              const std::string& fingerprint);
+
+    //! \brief Create fingerprint of a parsed deck.
+    //! \details Covers the path, size and modification time of the main
+    //!          deck file and of every included file keywords were read from.
+    //! \param deck Parsed deck
+    //! \param options Options which affect the processing of the deck
+    static std::string makeFingerprint(const Deck& deck,
+                                       const std::vector<std::string>& options);
+
+    //! \brief Set the fingerprint the cache file must match.
+    void setFingerprint(const std::string& fingerprint)
+    { m_fingerprint = fingerprint; }
+
+    //! \brief Returns true if the cache file exists, is complete and matches
+    //!        the fingerprint.
+    bool valid() const;
+
+    //! \brief Serialize and write all state objects to the cache file.
+    //! \details The file is written to a temporary file which is renamed
+    //!          on success, so a partially written cache is never used.
+    void write(EclipseState& eclState,
+               Schedule& schedule,
+               SummaryConfig& summaryConfig,
+               UDQState& udqState,
+               Action::State& actionState,
+               WellTestState& wtestState);
+
+    //! \brief Read and deserialize the EclipseState record.
+    void readEclipseState(EclipseState& eclState);
+
+    //! \brief Read and deserialize the schedule and dynamic state record.
+    void readDynamicState(Schedule& schedule,
+                          SummaryConfig& summaryConfig,
+                          UDQState& udqState,
+                          Action::State& actionState,
+                          WellTestState& wtestState);
+
+private:
+    //! \brief Read record number idx into the serializer buffer.
+    void readRecord_(std::size_t idx);
+
+    const Serialization::MemPacker m_packer_priv{}; //!< Packer instance
+    std::string m_fileName; //!< Name of cache file
+    std::string m_fingerprint; //!< Expected fingerprint
+};
+
+} // namespace Opm
+
+#endif // OPM_DECK_CACHE_HPP
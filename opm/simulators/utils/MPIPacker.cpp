@@ -75,11 +75,8 @@ unpack(std::bitset<Size>& data,
 std::size_t Packing<false,std::string>::
 packSize(const std::string& data, Parallel::MPIComm comm)
 {
-    int size;
-    MPI_Pack_size(1, Dune::MPITraits<std::size_t>::getType(), comm, &size);
-    int totalSize = size;
-    MPI_Pack_size(data.size(), MPI_CHAR, comm, &size);
-    return totalSize + size;
+    return Packing<true,std::size_t>::packSize(data.size(), comm) +
+           Packing<true,char>::packSize(data.data(), data.size(), comm);
 }
 
 void Packing<false,std::string>::
@@ -88,13 +85,8 @@ pack(const std::string& data,
      std::size_t& position,
      Parallel::MPIComm comm)
 {
-    std::size_t length = data.size();
-    int int_position = 0;
-    MPI_Pack(&length, 1, Dune::MPITraits<std::size_t>::getType(), buffer.data()+position,
-             mpi_buffer_size(buffer.size(), position), &int_position, comm);
-    MPI_Pack(data.data(), length, MPI_CHAR, buffer.data()+position, mpi_buffer_size(buffer.size(), position),
-             &int_position, comm);
-    position += int_position;
+    Packing<true,std::size_t>::pack(data.size(), buffer, position, comm);
+    Packing<true,char>::pack(data.data(), data.size(), buffer, position, comm);
 }
 
 void Packing<false,std::string>::
@@ -104,15 +96,9 @@ unpack(std::string& data,
        Opm::Parallel::MPIComm comm)
 {
     std::size_t length = 0;
-    int int_position = 0;
-    MPI_Unpack(buffer.data()+position, mpi_buffer_size(buffer.size(), position), &int_position, &length, 1,
-               Dune::MPITraits<std::size_t>::getType(), comm);
-    std::vector<char> cStr(length+1, '\0');
-    MPI_Unpack(buffer.data()+position, mpi_buffer_size(buffer.size(), position), &int_position, cStr.data(), length,
-               MPI_CHAR, comm);
-    position += int_position;
-    data.clear();
-    data.append(cStr.data(), length);
+    Packing<true,std::size_t>::unpack(length, buffer, position, comm);
+    data.resize(length);
+    Packing<true,char>::unpack(data.data(), length, buffer, position, comm);
 }
 
 std::size_t Packing<false,time_point>::
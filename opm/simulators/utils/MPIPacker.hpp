@@ -24,6 +24,7 @@
 
 #include <dune/common/parallel/mpitraits.hh>
 
+#include <algorithm>
 #include <bitset>
 #include <cstddef>
 #include <limits>
@@ -66,13 +67,14 @@ struct Packing<true,T>
     //! \param comm The communicator to use
     static std::size_t packSize(const T*, std::size_t n, Parallel::MPIComm comm)
     {
-        // For now we do not handle the situation where a a single call to packSize/pack/unpack
-        // is likely to require an MPI_Pack_size value larger than intmax
-        if (n*sizeof(T) > std::numeric_limits<int>::max())
-            throw std::invalid_argument("packSize will be larger than max integer - this is not supported.");
-        int size = 0;
-        MPI_Pack_size(n, Dune::MPITraits<T>::getType(), comm, &size);
-        return static_cast<std::size_t>(size);
+        // MPI counts and sizes are int, larger arrays are packed in chunks
+        std::size_t totalSize = 0;
+        for (std::size_t offset = 0; offset < n; offset += maxChunkLength) {
+            int size = 0;
+            MPI_Pack_size(chunkLength(n, offset), Dune::MPITraits<T>::getType(), comm, &size);
+            totalSize += static_cast<std::size_t>(size);
+        }
+        return totalSize;
     }
 
     //! \brief Pack a POD.
@@ -100,10 +102,13 @@ struct Packing<true,T>
                      std::size_t& position,
                      Parallel::MPIComm comm)
     {
-        int int_position = 0;
-        MPI_Pack(data, n, Dune::MPITraits<T>::getType(), buffer.data()+position,
-                 mpi_buffer_size(buffer.size(), position), &int_position, comm);
-        position += int_position;
+        for (std::size_t offset = 0; offset < n; offset += maxChunkLength) {
+            int int_position = 0;
+            MPI_Pack(data + offset, chunkLength(n, offset), Dune::MPITraits<T>::getType(),
+                     buffer.data()+position, mpi_buffer_size(buffer.size(), position),
+                     &int_position, comm);
+            position += int_position;
+        }
     }
 
     //! \brief Unpack a POD.
@@ -131,10 +136,25 @@ struct Packing<true,T>
                        std::size_t& position,
                        Parallel::MPIComm comm)
     {
-        int int_position = 0;
-        MPI_Unpack(buffer.data()+position, mpi_buffer_size(buffer.size(), position), &int_position, data, n,
-                   Dune::MPITraits<T>::getType(), comm);
-        position += int_position;
+        for (std::size_t offset = 0; offset < n; offset += maxChunkLength) {
+            int int_position = 0;
+            MPI_Unpack(buffer.data()+position, mpi_buffer_size(buffer.size(), position),
+                       &int_position, data + offset, chunkLength(n, offset),
+                       Dune::MPITraits<T>::getType(), comm);
+            position += int_position;
+        }
+    }
+
+private:
+    //! \brief Maximum number of elements packed by a single MPI call.
+    //! \details Keeps the packed size of a chunk well below the int limit
+    //!          of MPI_Pack_size, MPI_Pack and MPI_Unpack.
+    static constexpr std::size_t maxChunkLength =
+        std::max(std::size_t{1}, (std::size_t{1} << 30) / sizeof(T));
+
+    static int chunkLength(std::size_t n, std::size_t offset)
+    {
+        return static_cast<int>(std::min(maxChunkLength, n - offset));
     }
 };
 
@@ -25,6 +25,12 @@
 #include <opm/simulators/utils/MPIPacker.hpp>
 #include <opm/simulators/utils/ParallelCommunication.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+
 namespace Opm::Parallel {
 
 //! \brief Avoid mistakes in calls to broadcast() by wrapping the root
@@ -37,10 +43,19 @@ struct RootRank
 //! \brief Class for serializing and broadcasting data using MPI.
 class MpiSerializer : public Serializer<Mpi::Packer> {
 public:
-    explicit MpiSerializer(Parallel::Communication comm)
+    //! \brief Default size in bytes of the chunks the packed data is broadcast in.
+    static constexpr std::size_t defaultChunkSize = std::size_t{64} << 20;
+
+    //! \brief Constructor.
+    //! \param comm Communicator to use
+    //! \param chunkSize Size in bytes of the chunks the packed data is broadcast in
+    explicit MpiSerializer(Parallel::Communication comm,
+                           std::size_t chunkSize = defaultChunkSize)
         : Serializer<Mpi::Packer>(m_packer)
         , m_packer(comm)
         , m_comm(comm)
+        , m_chunkSize(std::clamp(chunkSize, std::size_t{1},
+                                 static_cast<std::size_t>(std::numeric_limits<int>::max())))
     {}
 
     template<typename... Args>
@@ -93,20 +108,33 @@ public:
     }
 
 private:
-    void broadcast_chunked(int root) {
-        const int maxChunkSize = std::numeric_limits<int>::max();
-        std::size_t remainingSize = m_packSize;
-        std::size_t pos = 0;
-        while (remainingSize > maxChunkSize) {
-            m_comm.broadcast(m_buffer.data()+pos, maxChunkSize, root);
-            pos += maxChunkSize;
-            remainingSize -= maxChunkSize;
+    //! \brief Broadcast the packed buffer in chunks of m_chunkSize bytes.
+    //! \details Up to maxPendingChunks non-blocking broadcasts are in flight
+    //!          at any time. Chunks are thus pipelined through the broadcast
+    //!          tree instead of each rank waiting for the full buffer before
+    //!          forwarding it.
+    void broadcast_chunked(int root)
+    {
+        constexpr std::size_t maxPendingChunks = 4;
+        std::array<MPI_Request, maxPendingChunks> requests{};
+
+        const std::size_t numChunks = (m_packSize + m_chunkSize - 1) / m_chunkSize;
+        for (std::size_t chunk = 0; chunk < numChunks; ++chunk) {
+            MPI_Request& request = requests[chunk % maxPendingChunks];
+            if (chunk >= maxPendingChunks) {
+                MPI_Wait(&request, MPI_STATUS_IGNORE);
+            }
+            const std::size_t pos = chunk * m_chunkSize;
+            const int count = static_cast<int>(std::min(m_chunkSize, m_packSize - pos));
+            MPI_Ibcast(m_buffer.data() + pos, count, MPI_BYTE, root, m_comm, &request);
         }
-        m_comm.broadcast(m_buffer.data()+pos, static_cast<int>(remainingSize), root);
+        MPI_Waitall(static_cast<int>(std::min(numChunks, maxPendingChunks)),
+                    requests.data(), MPI_STATUSES_IGNORE);
     }
 
     const Mpi::Packer m_packer; //!< Packer instance
     Parallel::Communication m_comm; //!< Communicator to use
+    std::size_t m_chunkSize; //!< Size in bytes of broadcast chunks
 };
 
 }
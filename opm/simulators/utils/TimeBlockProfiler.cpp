@@ -0,0 +1,180 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#include <opm/simulators/utils/TimeBlockProfiler.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <utility>
+
+namespace
+{
+
+    struct Counter
+    {
+        std::uint64_t count = 0;
+        Opm::TimeBlockProfiler::Clock::duration time{0};
+    };
+
+    using ThreadCounters = std::vector<Counter>;
+
+    // Registered timeblocks and the counters of all threads which have timed
+    // a block. The counters are owned here so that they outlive their threads.
+    struct Registry
+    {
+        std::mutex mutex;
+        std::vector<std::pair<std::string, std::string>> blocks;
+        std::map<std::pair<std::string, std::string>, std::size_t> index;
+        std::vector<std::unique_ptr<ThreadCounters>> threadCounters;
+    };
+
+    Registry& registry()
+    {
+        static Registry reg;
+        return reg;
+    }
+
+    ThreadCounters& threadCounters()
+    {
+        thread_local ThreadCounters* counters = nullptr;
+        if (!counters) {
+            auto& reg = registry();
+            std::lock_guard lock(reg.mutex);
+            counters = reg.threadCounters.emplace_back(std::make_unique<ThreadCounters>()).get();
+        }
+        return *counters;
+    }
+
+    std::string jsonEscape(const std::string& s)
+    {
+        std::string result;
+        for (const char c : s) {
+            if (c == '"' || c == '\\') {
+                result += '\\';
+            }
+            result += c;
+        }
+        return result;
+    }
+
+} // anonymous namespace
+
+namespace Opm
+{
+
+    std::atomic<bool> TimeBlockProfiler::enabled_{false};
+
+    std::size_t TimeBlockProfiler::registerBlock(std::string_view name, std::string_view subsystem)
+    {
+        // "Subsystem::PvtProps | Subsystem::SatProps" -> "PvtProps|SatProps"
+        std::string sub(subsystem);
+        constexpr std::string_view prefix = "Subsystem::";
+        for (auto pos = sub.find(prefix); pos != std::string::npos; pos = sub.find(prefix, pos)) {
+            sub.erase(pos, prefix.size());
+        }
+        sub.erase(std::remove(sub.begin(), sub.end(), ' '), sub.end());
+
+        auto& reg = registry();
+        std::lock_guard lock(reg.mutex);
+        auto key = std::make_pair(std::string(name), std::move(sub));
+        const auto it = reg.index.find(key);
+        if (it != reg.index.end()) {
+            return it->second;
+        }
+        const std::size_t id = reg.blocks.size();
+        reg.index.emplace(key, id);
+        reg.blocks.push_back(std::move(key));
+        return id;
+    }
+
+    void TimeBlockProfiler::add(const std::size_t id, const Clock::duration elapsed)
+    {
+        auto& counters = threadCounters();
+        if (id >= counters.size()) {
+            counters.resize(id + 1);
+        }
+        ++counters[id].count;
+        counters[id].time += elapsed;
+    }
+
+    std::vector<TimeBlockProfiler::Record> TimeBlockProfiler::localRecords()
+    {
+        auto& reg = registry();
+        std::lock_guard lock(reg.mutex);
+
+        std::vector<Counter> sum(reg.blocks.size());
+        for (const auto& counters : reg.threadCounters) {
+            for (std::size_t id = 0; id < counters->size(); ++id) {
+                sum[id].count += (*counters)[id].count;
+                sum[id].time += (*counters)[id].time;
+            }
+        }
+
+        std::vector<Record> records;
+        for (std::size_t id = 0; id < sum.size(); ++id) {
+            if (sum[id].count == 0) {
+                continue;
+            }
+            const double time = std::chrono::duration<double>(sum[id].time).count();
+            records.push_back({reg.blocks[id].first, reg.blocks[id].second,
+                               sum[id].count, time, time});
+        }
+        return records;
+    }
+
+    void TimeBlockProfiler::reset()
+    {
+        auto& reg = registry();
+        std::lock_guard lock(reg.mutex);
+        for (auto& counters : reg.threadCounters) {
+            std::fill(counters->begin(), counters->end(), Counter{});
+        }
+    }
+
+    void TimeBlockProfiler::writeCsv(std::ostream& os, const std::vector<Record>& records)
+    {
+        os << "name,subsystem,count,total_time,max_rank_time\n";
+        for (const auto& rec : records) {
+            os << fmt::format("{},{},{},{:.6e},{:.6e}\n", rec.name, rec.subsystem,
+                              rec.count, rec.totalTime, rec.maxRankTime);
+        }
+    }
+
+    void TimeBlockProfiler::writeJson(std::ostream& os, const std::vector<Record>& records)
+    {
+        os << "[\n";
+        for (std::size_t i = 0; i < records.size(); ++i) {
+            const auto& rec = records[i];
+            os << fmt::format("  {{\"name\": \"{}\", \"subsystem\": \"{}\", \"count\": {}, "
+                              "\"total_time\": {:.6e}, \"max_rank_time\": {:.6e}}}{}\n",
+                              jsonEscape(rec.name), jsonEscape(rec.subsystem), rec.count,
+                              rec.totalTime, rec.maxRankTime,
+                              i + 1 < records.size() ? "," : "");
+        }
+        os << "]\n";
+    }
+
+} // namespace Opm
@@ -0,0 +1,119 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_TIMEBLOCKPROFILER_HEADER_INCLUDED
+#define OPM_TIMEBLOCKPROFILER_HEADER_INCLUDED
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Opm
+{
+
+    /// Built-in backend for the OPM_TIMEBLOCK family of macros, see
+    /// TimeBlockProfilerMacros.hpp.
+    ///
+    /// Every timeblock is registered once, on its first execution, and gets
+    /// an index into per-thread arrays of counters. Timing a block therefore
+    /// only touches memory owned by the executing thread. Profiling is off
+    /// until enable() is called; a disabled timeblock costs one relaxed
+    /// atomic load.
+    ///
+    /// The counters of all threads are combined by collect(), which must not
+    /// be called while timeblocks are executed by other threads.
+    class TimeBlockProfiler
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr std::size_t invalidId = std::numeric_limits<std::size_t>::max();
+
+        /// Accumulated timings of one timeblock.
+        struct Record
+        {
+            std::string name;
+            std::string subsystem;
+            std::uint64_t count = 0;
+            double totalTime = 0.0;   //!< Summed over threads and processes [s].
+            double maxRankTime = 0.0; //!< Largest time spent by one process [s].
+        };
+
+        /// Times the enclosing scope if profiling is enabled on construction.
+        class ScopedTimer
+        {
+        public:
+            explicit ScopedTimer(const std::size_t id)
+                : id_(enabled() ? id : invalidId)
+            {
+                if (id_ != invalidId) {
+                    start_ = Clock::now();
+                }
+            }
+
+            ~ScopedTimer()
+            {
+                if (id_ != invalidId) {
+                    add(id_, Clock::now() - start_);
+                }
+            }
+
+            ScopedTimer(const ScopedTimer&) = delete;
+            ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+        private:
+            std::size_t id_;
+            Clock::time_point start_{};
+        };
+
+        static bool enabled()
+        { return enabled_.load(std::memory_order_relaxed); }
+
+        static void enable(bool on)
+        { enabled_.store(on, std::memory_order_relaxed); }
+
+        /// Return the index of a timeblock, registering it if it is new.
+        /// The subsystem is the spelling of the macro argument, from which
+        /// "Subsystem::" qualifiers and blanks are dropped.
+        static std::size_t registerBlock(std::string_view name, std::string_view subsystem);
+
+        /// Accumulated timings of this process, summed over all threads.
+        static std::vector<Record> localRecords();
+
+        /// Reset all counters to zero. Registered blocks are kept.
+        static void reset();
+
+        static void writeCsv(std::ostream& os, const std::vector<Record>& records);
+        static void writeJson(std::ostream& os, const std::vector<Record>& records);
+
+    private:
+        static void add(std::size_t id, Clock::duration elapsed);
+
+        static std::atomic<bool> enabled_;
+    };
+
+} // namespace Opm
+
+#endif // OPM_TIMEBLOCKPROFILER_HEADER_INCLUDED
@@ -0,0 +1,83 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_TIMEBLOCKPROFILERMACROS_HEADER_INCLUDED
+#define OPM_TIMEBLOCKPROFILERMACROS_HEADER_INCLUDED
+
+// Routes the OPM_TIMEBLOCK family of macros to TimeBlockProfiler.
+//
+// Do not include this file directly. With OPM_ENABLE_TIMEBLOCK_PROFILER the
+// build system passes it to the compiler as a forced include for every C++
+// translation unit, ahead of config.h. All translation units therefore see
+// the same macro definitions, and later includes of
+// <opm/common/TimingMacros.hpp> are no-ops. It must not depend on config.h.
+
+#include <opm/common/TimingMacros.hpp>
+
+#include <opm/simulators/utils/TimeBlockProfiler.hpp>
+
+#ifndef USE_TRACY
+
+#define HAVE_TIMEBLOCK_PROFILER 1
+
+#undef OPM_TIMEBLOCK
+#undef OPM_TIMEFUNCTION
+#undef OPM_TIMEBLOCK_LOCAL
+#undef OPM_TIMEFUNCTION_LOCAL
+
+#define OPM_TIMEBLOCK(blockname)                                          \
+    static const std::size_t opm_timeblock_id_##blockname =               \
+        ::Opm::TimeBlockProfiler::registerBlock(#blockname, "");          \
+    const ::Opm::TimeBlockProfiler::ScopedTimer                           \
+        opm_timeblock_##blockname(opm_timeblock_id_##blockname)
+
+#define OPM_TIMEFUNCTION()                                                \
+    static const std::size_t opm_timefunction_id =                       \
+        ::Opm::TimeBlockProfiler::registerBlock(__func__, "");            \
+    const ::Opm::TimeBlockProfiler::ScopedTimer                           \
+        opm_timefunction(opm_timefunction_id)
+
+// The _LOCAL variants mark fine-grained blocks in inner loops and, as for
+// the external tools, are only timed in builds with DETAILED_PROFILING.
+#if defined(DETAILED_PROFILING) && DETAILED_PROFILING
+
+#define OPM_TIMEBLOCK_LOCAL(blockname, subsystem)                         \
+    static const std::size_t opm_timeblock_id_##blockname =               \
+        ::Opm::TimeBlockProfiler::registerBlock(#blockname, #subsystem);  \
+    const ::Opm::TimeBlockProfiler::ScopedTimer                           \
+        opm_timeblock_##blockname(opm_timeblock_id_##blockname)
+
+#define OPM_TIMEFUNCTION_LOCAL(subsystem)                                 \
+    static const std::size_t opm_timefunction_id =                       \
+        ::Opm::TimeBlockProfiler::registerBlock(__func__, #subsystem);    \
+    const ::Opm::TimeBlockProfiler::ScopedTimer                           \
+        opm_timefunction(opm_timefunction_id)
+
+#else
+
+#define OPM_TIMEBLOCK_LOCAL(blockname, subsystem) \
+    do { /* nothing */ } while (false)
+#define OPM_TIMEFUNCTION_LOCAL(subsystem) \
+    do { /* nothing */ } while (false)
+
+#endif // DETAILED_PROFILING
+
+#endif // USE_TRACY
+
+#endif // OPM_TIMEBLOCKPROFILERMACROS_HEADER_INCLUDED
@@ -0,0 +1,139 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#include <opm/simulators/utils/TimeBlockReport.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <numeric>
+#include <string>
+#include <utility>
+
+namespace Opm
+{
+
+    std::vector<TimeBlockProfiler::Record>
+    collectTimeBlocks(const Parallel::Communication& comm)
+    {
+        using Record = TimeBlockProfiler::Record;
+
+        const auto local = TimeBlockProfiler::localRecords();
+
+        // Names are sent as "name\tsubsystem\n" lines, counts and times as
+        // pairs of doubles.
+        std::string names;
+        std::vector<double> values;
+        for (const auto& rec : local) {
+            names += rec.name + '\t' + rec.subsystem + '\n';
+            values.push_back(static_cast<double>(rec.count));
+            values.push_back(rec.totalTime);
+        }
+
+        const auto gather = [&comm](const auto& send, auto& recv, std::vector<int>& sizes)
+        {
+            const int size = send.size();
+            sizes.resize(comm.size());
+            comm.allgather(&size, 1, sizes.data());
+            std::vector<int> displ(comm.size() + 1, 0);
+            std::partial_sum(sizes.begin(), sizes.end(), displ.begin() + 1);
+            recv.resize(displ.back());
+            comm.gatherv(send.data(), size, recv.data(), sizes.data(), displ.data(), 0);
+        };
+
+        std::string allNames;
+        std::vector<double> allValues;
+        std::vector<int> nameSizes;
+        std::vector<int> valueSizes;
+        gather(names, allNames, nameSizes);
+        gather(values, allValues, valueSizes);
+
+        if (comm.rank() != 0) {
+            return {};
+        }
+
+        std::map<std::pair<std::string, std::string>, Record> merged;
+        std::size_t namePos = 0;
+        std::size_t valuePos = 0;
+        for (int rank = 0; rank < comm.size(); ++rank) {
+            const std::size_t nameEnd = namePos + nameSizes[rank];
+            while (namePos < nameEnd) {
+                const auto tab = allNames.find('\t', namePos);
+                const auto eol = allNames.find('\n', tab);
+                auto key = std::make_pair(allNames.substr(namePos, tab - namePos),
+                                          allNames.substr(tab + 1, eol - tab - 1));
+                namePos = eol + 1;
+
+                auto& rec = merged[key];
+                rec.name = key.first;
+                rec.subsystem = key.second;
+                rec.count += static_cast<std::uint64_t>(allValues[valuePos]);
+                rec.totalTime += allValues[valuePos + 1];
+                rec.maxRankTime = std::max(rec.maxRankTime, allValues[valuePos + 1]);
+                valuePos += 2;
+            }
+        }
+
+        std::vector<Record> records;
+        records.reserve(merged.size());
+        for (auto& entry : merged) {
+            records.push_back(std::move(entry.second));
+        }
+        std::sort(records.begin(), records.end(),
+                  [](const Record& a, const Record& b) { return a.totalTime > b.totalTime; });
+        return records;
+    }
+
+    void writeTimeBlockReport(const Parallel::Communication& comm,
+                              std::string_view output_dir,
+                              std::string_view base_name)
+    {
+        if (!TimeBlockProfiler::enabled()) {
+            return;
+        }
+
+        const auto records = collectTimeBlocks(comm);
+        if (comm.rank() != 0) {
+            return;
+        }
+
+        namespace fs = ::std::filesystem;
+        const auto base = fs::path{output_dir} / fs::path{base_name}.concat(".TIMEBLOCKS");
+
+        auto csv = base;
+        std::ofstream csvFile(csv.concat(".csv"));
+        TimeBlockProfiler::writeCsv(csvFile, records);
+
+        auto json = base;
+        std::ofstream jsonFile(json.concat(".json"));
+        TimeBlockProfiler::writeJson(jsonFile, records);
+
+        OpmLog::info(fmt::format("Timeblock profile written to {} and {}",
+                                 csv.string(), json.string()));
+    }
+
+} // namespace Opm
@@ -0,0 +1,47 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_TIMEBLOCKREPORT_HEADER_INCLUDED
+#define OPM_TIMEBLOCKREPORT_HEADER_INCLUDED
+
+#include <opm/simulators/utils/ParallelCommunication.hpp>
+#include <opm/simulators/utils/TimeBlockProfiler.hpp>
+
+#include <string_view>
+#include <vector>
+
+namespace Opm
+{
+
+    /// Accumulated TimeBlockProfiler timings of all processes, sorted by
+    /// decreasing total time. Collective; the result is only complete on
+    /// rank 0.
+    std::vector<TimeBlockProfiler::Record>
+    collectTimeBlocks(const Parallel::Communication& comm);
+
+    /// Collect the timings of all processes and write them to
+    /// <output_dir>/<base_name>.TIMEBLOCKS.csv and .json on rank 0.
+    /// Collective; does nothing if profiling is not enabled.
+    void writeTimeBlockReport(const Parallel::Communication& comm,
+                              std::string_view output_dir,
+                              std::string_view base_name);
+
+} // namespace Opm
+
+#endif // OPM_TIMEBLOCKREPORT_HEADER_INCLUDED
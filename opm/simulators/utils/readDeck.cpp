@@ -67,6 +67,7 @@
 
 #include <opm/simulators/flow/KeywordValidation.hpp>
 #include <opm/simulators/flow/ValidationFunctions.hpp>
+#include <opm/simulators/utils/DeckCache.hpp>
 #include <opm/simulators/utils/FullySupportedFlowKeywords.hpp>
 #include <opm/simulators/utils/ParallelEclipseState.hpp>
 #include <opm/simulators/utils/ParallelSerialization.hpp>
@@ -83,6 +84,7 @@
 #include <regex>
 #include <sstream>
 #include <stdexcept>
+#include <string_view>
 #include <system_error>
 #include <utility>
 #include <vector>
@@ -346,7 +348,10 @@ namespace {
                       const bool                           keepKeywords,
                       const std::optional<int>&            outputInterval,
                       Opm::ErrorGuard&                     errorGuard,
-                      const bool                           slaveMode)
+                      const bool                           slaveMode,
+                      Opm::DeckCache*                      deckCache,
+                      const std::vector<std::string>&      deckCacheOptions,
+                      bool&                                loadedFromCache)
     {
         OPM_TIMEBLOCK(readDeck);
 
@@ -364,12 +369,34 @@ namespace {
                                        treatCriticalAsNonCritical,
                                        errorGuard);
 
+        // The fingerprint covers all files read by the parser, so the cache
+        // is only valid if none of them has changed.
+        bool validDeckCache = false;
+        if (deckCache != nullptr) {
+            deckCache->setFingerprint(Opm::DeckCache::makeFingerprint(deck, deckCacheOptions));
+            validDeckCache = deckCache->valid();
+        }
+
         if (eclipseState == nullptr) {
             OPM_TIMEBLOCK(createEclState);
             eclipseState = createEclipseState(comm, deck);
         }
 
-        if (eclipseState->getInitConfig().restartRequested()) {
+        // Restarted runs are never cached, see readDeck().
+        loadedFromCache = validDeckCache &&
+            !eclipseState->getInitConfig().restartRequested();
+
+        if (loadedFromCache) {
+            OPM_TIMEBLOCK(readDeckCache);
+            schedule = std::make_shared<Opm::Schedule>(std::move(python));
+            summaryConfig = std::make_shared<Opm::SummaryConfig>();
+            udqState = std::make_unique<Opm::UDQState>(0);
+            actionState = std::make_unique<Opm::Action::State>();
+            wtestState = std::make_unique<Opm::WellTestState>();
+            deckCache->readDynamicState(*schedule, *summaryConfig, *udqState,
+                                        *actionState, *wtestState);
+        }
+        else if (eclipseState->getInitConfig().restartRequested()) {
             loadObjectsFromRestart(deck, parser, *parseContext,
                                    initFromRestart, outputInterval,
                                    lowActionParsingStrictness, keepKeywords,
@@ -385,8 +412,10 @@ namespace {
                                            errorGuard, slaveMode);
         }
 
-        checkScheduleKeywordConsistency(*schedule);
-        checkSatelliteGroupParentControls(*schedule);
+        if (!loadedFromCache) {
+            checkScheduleKeywordConsistency(*schedule);
+            checkSatelliteGroupParentControls(*schedule);
+        }
         eclipseState->appendAqufluxSchedule(schedule->getAquiferFluxSchedule());
 
         if (Opm::OpmLog::hasBackend("STDOUT_LOGGER")) {
@@ -394,6 +423,12 @@ namespace {
             setupMessageLimiter((*schedule)[0].message_limits(), "STDOUT_LOGGER");
         }
 
+        if (loadedFromCache) {
+            // The cached objects passed all consistency checks when the
+            // cache was written.
+            return;
+        }
+
         if (summaryConfig == nullptr) {
             summaryConfig = std::make_shared<Opm::SummaryConfig>
                 (deck, *schedule, eclipseState->fieldProps(),
@@ -699,12 +734,33 @@ void Opm::readDeck(Opm::Parallel::Communication    comm,
                    const bool                      checkDeck,
                    const bool                      keepKeywords,
                    const std::optional<int>&       outputInterval,
-                   const bool                      slaveMode)
+                   const bool                      slaveMode,
+                   const std::string&              deckCacheFile,
+                   std::string_view                moduleVersion)
 {
     auto errorGuard = std::make_unique<ErrorGuard>();
     int parseSuccess = 1; // > 0 is success
     std::string failureMessage;
 
+    // The cache only replaces objects created here, never user supplied ones.
+    // The I/O rank sets the fingerprint once the deck has been parsed. The
+    // other ranks only read the cache after the I/O rank has validated it.
+    std::optional<DeckCache> deckCache;
+    std::vector<std::string> deckCacheOptions;
+    if (!deckCacheFile.empty() && (eclipseState == nullptr) &&
+        (schedule == nullptr) && (summaryConfig == nullptr))
+    {
+        deckCache.emplace(deckCacheFile, std::string{});
+        deckCacheOptions = {std::string(moduleVersion),
+                            parsingStrictness,
+                            actionParsingStrictness,
+                            inputSkipMode,
+                            std::to_string(keepKeywords),
+                            std::to_string(outputInterval.value_or(-1)),
+                            std::to_string(slaveMode)};
+    }
+    bool loadedFromCache = false;
+
     if (parsingStrictness != "high" && parsingStrictness != "normal" && parsingStrictness != "low") {
         OPM_THROW(std::runtime_error,
                   fmt::format("Incorrect value {} for parameter ParsingStrictness, must be 'high', 'normal', or 'low'", parsingStrictness));
@@ -732,11 +788,33 @@ void Opm::readDeck(Opm::Parallel::Communication    comm,
                          eclipseState, schedule, udqState, actionState, wtestState,
                          summaryConfig, std::move(python), initFromRestart,
                          checkDeck, treatCriticalAsNonCritical, lowActionParsingStrictness,
-                         keepKeywords, outputInterval, *errorGuard, slaveMode);
+                         keepKeywords, outputInterval, *errorGuard, slaveMode,
+                         deckCache.has_value() ? &*deckCache : nullptr,
+                         deckCacheOptions, loadedFromCache);
+            if (loadedFromCache) {
+                OpmLog::info(fmt::format("Loaded schedule and summary configuration "
+                                         "from deck cache '{}'", deckCacheFile));
+            }
 
             // Update schedule so that re-parsing after actions use same strictness
             assert(schedule);
             schedule->treat_critical_as_non_critical(treatCriticalAsNonCritical);
+
+            // Restarted runs are not cached as the state objects also depend
+            // on the restart file.
+            if (deckCache.has_value() && !loadedFromCache && !*errorGuard &&
+                !eclipseState->getInitConfig().restartRequested())
+            {
+                try {
+                    deckCache->write(*eclipseState, *schedule, *summaryConfig,
+                                     *udqState, *actionState, *wtestState);
+                    OpmLog::info(fmt::format("Deck cache written to '{}'", deckCacheFile));
+                }
+                catch (const std::exception& e) {
+                    OpmLog::warning(fmt::format("Could not write deck cache '{}': {}",
+                                                deckCacheFile, e.what()));
+                }
+            }
         }
         catch (const OpmInputError& input_error) {
             failureMessage = input_error.what();
@@ -760,7 +838,34 @@ void Opm::readDeck(Opm::Parallel::Communication    comm,
     // serializing the non-existent TableManager)
     parseSuccess = comm.min(parseSuccess);
     try {
-        if (parseSuccess) {
+        // All ranks load the state from the cache if the I/O rank did. The
+        // cache file need not be visible to all processes, e.g. on a
+        // non-shared file system, so if any process fails to read it the
+        // state is broadcast from the I/O rank instead.
+        int bcastFromCache = loadedFromCache;
+        comm.broadcast(&bcastFromCache, 1, 0);
+        if (parseSuccess && bcastFromCache) {
+            int readSuccess = 1;
+            if (comm.rank() != 0) {
+                OPM_TIMEBLOCK(readDeckCache);
+                try {
+                    deckCache->readEclipseState(*eclipseState);
+                    deckCache->readDynamicState(*schedule, *summaryConfig, *udqState,
+                                                *actionState, *wtestState);
+                }
+                catch (const std::exception& e) {
+                    OpmLog::warning(fmt::format("Rank {} could not read deck cache '{}': {}",
+                                                comm.rank(), deckCacheFile, e.what()));
+                    readSuccess = 0;
+                }
+            }
+            bcastFromCache = comm.min(readSuccess);
+            if (!bcastFromCache && comm.rank() == 0) {
+                OpmLog::info("Deck cache not readable on all processes, "
+                             "distributing the state from the I/O rank instead");
+            }
+        }
+        if (parseSuccess && !bcastFromCache) {
             OPM_TIMEBLOCK(eclBcast);
             eclStateBroadcast(comm, *eclipseState, *schedule,
                               *summaryConfig, *udqState, *actionState, *wtestState);
@@ -28,6 +28,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 
 namespace Opm {
     class EclipseState;
@@ -84,6 +85,14 @@ setupLogging(Parallel::Communication& comm,
 ///
 /// If pointers already contains objects then they are used otherwise they
 /// are created and can be used outside later.
+///
+/// If deckCacheFile is non-empty and none of the objects are given, the
+/// objects created from the deck are written to a binary cache file. On later
+/// runs with unchanged deck and include files, simulator version and options,
+/// the schedule and the dynamic objects are loaded from this file on the I/O
+/// rank and the other ranks load all objects from it instead of receiving them
+/// by broadcast.
+/// Restarted runs are never cached.
 void readDeck(Parallel::Communication         comm,
               const std::string&              deckFilename,
               std::shared_ptr<EclipseState>&  eclipseState,
@@ -100,7 +109,9 @@ void readDeck(Parallel::Communication         comm,
               bool                            checkDeck,
               bool                            keepKeywords,
               const std::optional<int>&       outputInterval,
-              bool                            slaveMode);
+              bool                            slaveMode,
+              const std::string&              deckCacheFile,
+              std::string_view                moduleVersion);
 
 void verifyValidCellGeometry(Parallel::Communication comm,
                              const EclipseState&     eclipseState);
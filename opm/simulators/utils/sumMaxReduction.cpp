@@ -0,0 +1,175 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#include <opm/simulators/utils/sumMaxReduction.hpp>
+
+#if HAVE_MPI
+
+#include <dune/common/parallel/mpitraits.hh>
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <mpi.h>
+
+namespace
+{
+
+    // The reduced buffer is a single element of a contiguous datatype, laid out as
+    // [number of sums, sums..., maxes...]. Keeping the whole buffer in one element
+    // ensures that MPI never splits it, so the layout is known to the operator.
+    template<class Scalar>
+    void sumMaxOp(void* in, void* inout, int* len, MPI_Datatype* type)
+    {
+        int typeSize = 0;
+        MPI_Type_size(*type, &typeSize);
+        const std::size_t size = typeSize / sizeof(Scalar);
+
+        const auto* a = static_cast<const Scalar*>(in);
+        auto* b = static_cast<Scalar*>(inout);
+        for (int elem = 0; elem < *len; ++elem, a += size, b += size) {
+            const auto numSum = static_cast<std::size_t>(a[0]);
+            for (std::size_t i = 1; i <= numSum; ++i) {
+                b[i] += a[i];
+            }
+            for (std::size_t i = numSum + 1; i < size; ++i) {
+                b[i] = std::max(b[i], a[i]);
+            }
+        }
+    }
+
+    // The operator and the datatypes of the reduction for one Scalar type.
+    // They are created on first use and kept until MPI_Finalize(), which
+    // frees them through an attribute of MPI_COMM_SELF.
+    template<class Scalar>
+    class SumMaxTypes
+    {
+    public:
+        static SumMaxTypes& instance()
+        {
+            static SumMaxTypes types;
+            return types;
+        }
+
+        MPI_Op op() const
+        {
+            return op_;
+        }
+
+        // Contiguous datatype of size elements.
+        MPI_Datatype type(const std::size_t size)
+        {
+            auto it = types_.find(size);
+            if (it == types_.end()) {
+                MPI_Datatype type;
+                MPI_Type_contiguous(size, Dune::MPITraits<Scalar>::getType(), &type);
+                MPI_Type_commit(&type);
+                it = types_.emplace(size, type).first;
+            }
+            return it->second;
+        }
+
+    private:
+        SumMaxTypes()
+        {
+            MPI_Op_create(&sumMaxOp<Scalar>, /*commute=*/1, &op_);
+            int keyval;
+            MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN, &release, &keyval, nullptr);
+            MPI_Comm_set_attr(MPI_COMM_SELF, keyval, this);
+            MPI_Comm_free_keyval(&keyval);
+        }
+
+        static int release(MPI_Comm, int, void* attr, void*)
+        {
+            auto* self = static_cast<SumMaxTypes*>(attr);
+            for (auto& entry : self->types_) {
+                MPI_Type_free(&entry.second);
+            }
+            self->types_.clear();
+            MPI_Op_free(&self->op_);
+            return MPI_SUCCESS;
+        }
+
+        MPI_Op op_ = MPI_OP_NULL;
+        std::map<std::size_t, MPI_Datatype> types_;
+    };
+
+} // anonymous namespace
+
+namespace Opm
+{
+
+    template<class Scalar>
+    void sumMaxReduction(const Parallel::Communication& comm,
+                         std::vector<Scalar>& sums,
+                         std::vector<Scalar>& maxes)
+    {
+        if (comm.size() == 1) {
+            return;
+        }
+
+        std::vector<Scalar> buffer;
+        buffer.reserve(1 + sums.size() + maxes.size());
+        buffer.push_back(static_cast<Scalar>(sums.size()));
+        buffer.insert(buffer.end(), sums.begin(), sums.end());
+        buffer.insert(buffer.end(), maxes.begin(), maxes.end());
+
+        auto& types = SumMaxTypes<Scalar>::instance();
+        MPI_Allreduce(MPI_IN_PLACE, buffer.data(), 1,
+                      types.type(buffer.size()), types.op(), comm);
+
+        const auto sumEnd = buffer.begin() + 1 + sums.size();
+        std::copy(buffer.begin() + 1, sumEnd, sums.begin());
+        std::copy(sumEnd, buffer.end(), maxes.begin());
+    }
+
+} // namespace Opm
+
+#else // HAVE_MPI
+
+namespace Opm
+{
+
+    template<class Scalar>
+    void sumMaxReduction(const Parallel::Communication&,
+                         std::vector<Scalar>&,
+                         std::vector<Scalar>&)
+    {
+    }
+
+} // namespace Opm
+
+#endif // HAVE_MPI
+
+namespace Opm
+{
+
+    template void sumMaxReduction<double>(const Parallel::Communication&,
+                                          std::vector<double>&,
+                                          std::vector<double>&);
+
+#if FLOW_INSTANTIATE_FLOAT
+    template void sumMaxReduction<float>(const Parallel::Communication&,
+                                         std::vector<float>&,
+                                         std::vector<float>&);
+#endif
+
+} // namespace Opm
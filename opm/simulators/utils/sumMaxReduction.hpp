@@ -0,0 +1,40 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_SUMMAXREDUCTION_HEADER_INCLUDED
+#define OPM_SUMMAXREDUCTION_HEADER_INCLUDED
+
+#include <opm/simulators/utils/ParallelCommunication.hpp>
+
+#include <vector>
+
+namespace Opm
+{
+
+    /// Global sum of \p sums and global maximum of \p maxes, computed with a
+    /// single collective operation. The result is stored in the input vectors
+    /// on all processes. Both vectors must have the same size on all processes.
+    template<class Scalar>
+    void sumMaxReduction(const Parallel::Communication& comm,
+                         std::vector<Scalar>& sums,
+                         std::vector<Scalar>& maxes);
+
+} // namespace Opm
+
+#endif // OPM_SUMMAXREDUCTION_HEADER_INCLUDED
@@ -333,6 +333,11 @@ template<class Scalar> class WellContributions;
             auto end() const { return well_container_.end(); }
             bool empty() const { return well_container_.empty(); }
 
+            /// Changes whenever the well container is rebuilt, i.e. when
+            /// the wells or their perforated cells may have changed.
+            std::size_t wellContainerGeneration() const
+            { return well_container_generation_; }
+
             bool addMatrixContributions() const
             { return param_.matrix_add_well_contributions_; }
 
@@ -364,6 +369,16 @@ template<class Scalar> class WellContributions;
             void updateCellRatesForDomain(int domainIndex,
                                           const std::map<std::string, int>& well_domain_map);
 
+            // Fill cellRates_ with contributions from all wells, with an entry
+            // for every perforated cell, such that concurrent domain solves can
+            // later update their entries without changing the map structure.
+            void prepareCellRatesForConcurrentDomains();
+
+            // Overwrite the cellRates_ entries of wells in a specific domain.
+            // No entries are inserted or removed, see prepareCellRatesForConcurrentDomains().
+            void updateCellRatesForDomainInPlace(int domainIndex,
+                                                 const std::map<std::string, int>& well_domain_map);
+
             const Grid& grid() const
             { return simulator_.vanguard().grid(); }
 
@@ -497,6 +512,7 @@ template<class Scalar> class WellContributions;
 
             // a vector of all the wells.
             std::vector<WellInterfacePtr> well_container_{};
+            std::size_t well_container_generation_{0};
 
             std::vector<bool> is_cell_perforated_{};
 
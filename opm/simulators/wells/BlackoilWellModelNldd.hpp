@@ -136,13 +136,6 @@ private:
 
     void assembleWellEq(const double dt,
                         const Domain& domain);
-
-    // These members are used to avoid reallocation in specific functions
-    // instead of using local variables.
-    // Their state is not relevant between function calls, so they can
-    // (and must) be mutable, as the functions using them are const.
-    mutable BVector x_local_;
-
 };
 
 } // namespace Opm
@@ -31,6 +31,10 @@
 
 #include <algorithm>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace Opm {
 
 template<typename TypeTag>
@@ -95,7 +99,14 @@ assemble(const double dt,
     this->updateWellControls(domain);
     this->assembleWellEq(dt, domain);
 
-    // Update cellRates_ with current contributions from wells in this domain for reservoir linearization
+    // Update cellRates_ with current contributions from wells in this domain for reservoir linearization.
+    // Concurrent domain solves share cellRates_, so they may only overwrite their own entries.
+#ifdef _OPENMP
+    if (omp_in_parallel()) {
+        wellModel_.updateCellRatesForDomainInPlace(domain.index, this->well_domain());
+        return;
+    }
+#endif
     wellModel_.updateCellRatesForDomain(domain.index, this->well_domain());
 }
 
@@ -152,16 +163,18 @@ recoverWellSolutionAndUpdateWellState(const BVector& x,
     // parallel but for each individual domain of each rank.
     // Use do_mpi_gather=false to avoid MPI collective operations.
     auto loggerGuard = wellModel_.groupStateHelper().pushLogger(/*do_mpi_gather=*/false);
+    // Local scratch vector, domains may be solved concurrently.
+    BVector x_local;
     for (const auto& well : wellModel_.localNonshutWells()) {
         if (this->well_domain().at(well->name()) == domainIdx) {
             const auto& cells = well->cells();
-            x_local_.resize(cells.size());
+            x_local.resize(cells.size());
 
             for (size_t i = 0; i < cells.size(); ++i) {
-                x_local_[i] = x[cells[i]];
+                x_local[i] = x[cells[i]];
             }
             well->recoverWellSolutionAndUpdateWellState(wellModel_.simulator(),
-                                                        x_local_,
+                                                        x_local,
                                                         wellModel_.groupStateHelper(),
                                                         wellModel_.wellState());
         }
@@ -932,6 +932,7 @@ namespace Opm {
         const int nw = this->numLocalWells();
 
         well_container_.clear();
+        ++well_container_generation_;
 
         if (nw > 0) {
             well_container_.reserve(nw);
@@ -1471,6 +1472,45 @@ namespace Opm {
         }
     }
 
+    template<typename TypeTag>
+    void
+    BlackoilWellModel<TypeTag>::
+    prepareCellRatesForConcurrentDomains()
+    {
+        updateCellRates();
+        for (const auto& well : well_container_) {
+            for (const auto cellIdx : well->cells()) {
+                cellRates_.try_emplace(cellIdx, 0.0);
+            }
+        }
+    }
+
+    template<typename TypeTag>
+    void
+    BlackoilWellModel<TypeTag>::
+    updateCellRatesForDomainInPlace(int domainIndex, const std::map<std::string, int>& well_domain_map)
+    {
+        std::map<int, RateVector> domainRates;
+        for (const auto& well : well_container_) {
+            const auto it = well_domain_map.find(well->name());
+            if (it != well_domain_map.end() && it->second == domainIndex) {
+                for (const auto cellIdx : well->cells()) {
+                    domainRates.try_emplace(cellIdx, 0.0);
+                }
+                well->addCellRates(domainRates);
+            }
+        }
+        for (const auto& [cellIdx, rates] : domainRates) {
+            const auto it = cellRates_.find(cellIdx);
+            if (it == cellRates_.end()) {
+                OPM_THROW(std::logic_error,
+                          fmt::format("Cell {} missing from cell rates, "
+                                      "call prepareCellRatesForConcurrentDomains() first", cellIdx));
+            }
+            it->second = rates;
+        }
+    }
+
 #if COMPILE_GPU_BRIDGE
     template<typename TypeTag>
     void
@@ -662,7 +662,7 @@ Scalar
 GroupConstraintCalculator<Scalar, IndexTraits>::
 TopToBottomCalculator::
 computeAddbackEfficiency_(
-    const std::vector<std::string>& chain,
+    const GroupChain& chain,
     const std::size_t local_reduction_level) const
 {
     // Compute partial efficiency factor from local_reduction_level down to the entity.
@@ -675,7 +675,9 @@ computeAddbackEfficiency_(
     Scalar efficiency = 1.0;
     for (std::size_t jj = local_reduction_level + 1; jj <= num_ancestors; ++jj) {
         const std::string& name = chain[jj];
-        if (this->schedule().hasGroup(name, this->reportStepIdx())) {
+        if (const int group_idx = chain.groupIndex(jj); group_idx != GroupTopology::InvalidIndex) {
+            efficiency *= this->groupStateHelper().groupTopology().groupEfficiencyFactor(group_idx);
+        } else if (this->schedule().hasGroup(name, this->reportStepIdx())) {
             const auto& grp = this->schedule().getGroup(name, this->reportStepIdx());
             efficiency *= grp.getGroupEfficiencyFactor();
         } else if (this->schedule().hasWell(name, this->reportStepIdx())) {
@@ -726,7 +728,7 @@ getSlaveGroupReservoirRate_(const Group& group)
 }
 
 template<class Scalar, class IndexTraits>
-std::vector<std::string>
+GroupChain
 GroupConstraintCalculator<Scalar, IndexTraits>::
 TopToBottomCalculator::
 getGroupChainTopBot_() const
@@ -738,7 +740,7 @@ template<class Scalar, class IndexTraits>
 std::size_t
 GroupConstraintCalculator<Scalar, IndexTraits>::
 TopToBottomCalculator::
-getLocalReductionLevel_(const std::vector<std::string>& chain)
+getLocalReductionLevel_(const GroupChain& chain)
 {
     const std::size_t num_ancestors = chain.size() - 1;
     std::size_t local_reduction_level = 0;
@@ -248,11 +248,11 @@ public:
 
     private:
         bool bottomGroupHasIndividualControl_();
-        Scalar computeAddbackEfficiency_(const std::vector<std::string>& chain,
+        Scalar computeAddbackEfficiency_(const GroupChain& chain,
                                          const std::size_t local_reduction_level) const;
         Scalar getBottomGroupCurrentRateAvailable_() const;
-        std::vector<std::string> getGroupChainTopBot_() const;
-        std::size_t getLocalReductionLevel_(const std::vector<std::string>& chain);
+        GroupChain getGroupChainTopBot_() const;
+        std::size_t getLocalReductionLevel_(const GroupChain& chain);
         TargetCalculatorType getProductionTargetCalculator_(const Group& group) const {
             return this->parent_calculator_.getProductionTargetCalculator(group); }
         TargetCalculatorType getInjectionTargetCalculator_(const Group& group) const {
@@ -29,6 +29,7 @@
 #include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
 #include <opm/input/eclipse/Schedule/ResCoup/ReservoirCouplingInfo.hpp>
 #include <opm/simulators/wells/FractionCalculator.hpp>
+#include <opm/simulators/wells/GroupTopology.hpp>
 #include <opm/simulators/wells/TargetCalculator.hpp>
 
 #include <fmt/format.h>
@@ -39,6 +40,7 @@
 #include <stack>
 #include <set>
 #include <unordered_set>
+#include <utility>
 
 namespace Opm
 {
@@ -84,6 +86,7 @@ GroupStateHelper<Scalar, IndexTraits>::GroupStateHelper(WellState<Scalar, IndexT
     , phase_usage_info_ {phase_usage_info}
     , comm_ {comm}
     , terminal_output_ {terminal_output}
+    , group_topology_ {schedule, 0}
 {
 }
 
@@ -188,8 +191,7 @@ GroupStateHelper<Scalar, IndexTraits>::checkGroupConstraintsInj(const std::strin
         for (std::size_t ii = 1; ii < num_ancestors; ++ii) {
             if (this->guide_rate_.has(chain[ii], injection_phase)) {
                 const auto& guided_group = chain[ii];
-                const Scalar grefficiency
-                    = this->schedule_.getGroup(guided_group, this->report_step_).getGroupEfficiencyFactor();
+                const Scalar grefficiency = this->chainGroupEfficiencyFactor_(chain, ii);
                 const Scalar current_rate_fraction = grefficiency * local_current_rate_lambda(guided_group)
                     / local_current_rate_lambda(chain[ii - 1]);
                 const Scalar guiderate_fraction = local_fraction_lambda(guided_group);
@@ -329,8 +331,7 @@ GroupStateHelper<Scalar, IndexTraits>::checkGroupConstraintsProd(const std::stri
         for (std::size_t ii = 1; ii < num_ancestors; ++ii) {
             if (this->guide_rate_.has(chain[ii])) {
                 const auto& guided_group = chain[ii];
-                const Scalar grefficiency
-                    = this->schedule_.getGroup(guided_group, this->report_step_).getGroupEfficiencyFactor();
+                const Scalar grefficiency = this->chainGroupEfficiencyFactor_(chain, ii);
                 const Scalar current_rate_fraction = grefficiency * local_current_rate_lambda(guided_group)
                     / (local_current_rate_lambda(chain[ii - 1]));
                 const Scalar guiderate_fraction = local_fraction_lambda(guided_group);
@@ -924,10 +925,15 @@ GroupStateHelper<Scalar, IndexTraits>::getWellRateVector(const std::string& name
 }
 
 template <typename Scalar, typename IndexTraits>
-std::vector<std::string>
+GroupChain
 GroupStateHelper<Scalar, IndexTraits>::groupChainTopBot(const std::string& bottom,
                                                        const std::string& top) const
 {
+    if (auto chain = this->group_topology_.chainTopBot(bottom, top)) {
+        return std::move(*chain);
+    }
+
+    // Not covered by the compiled topology, walk the schedule instead.
     // Get initial parent, 'bottom' can be a well or a group.
     std::string parent;
     if (this->schedule_.hasWell(bottom, this->report_step_)) {
@@ -948,7 +954,7 @@ GroupStateHelper<Scalar, IndexTraits>::groupChainTopBot(const std::string& botto
 
     // Reverse order and return.
     std::ranges::reverse(chain);
-    return chain;
+    return GroupChain{std::move(chain)};
 }
 
 template <typename Scalar, typename IndexTraits>
@@ -1779,7 +1785,7 @@ GroupStateHelper<Scalar, IndexTraits>::validateInjectionTopupPhasesRecursive_(
 template <typename Scalar, typename IndexTraits>
 template <typename ReductionLambda, typename FractionLambda>
 Scalar
-GroupStateHelper<Scalar, IndexTraits>::applyReductionsAndFractions_(const std::vector<std::string>& chain,
+GroupStateHelper<Scalar, IndexTraits>::applyReductionsAndFractions_(const GroupChain& chain,
                                                                     const Scalar orig_target,
                                                                     const Scalar current_rate_available,
                                                                     const std::size_t local_reduction_level,
@@ -1880,7 +1886,7 @@ checkProductionRateConstraint_(const Group& group,
 // Called from applyReductionsAndFractions_() to compute the addback efficiency factor.
 template <typename Scalar, typename IndexTraits>
 Scalar
-GroupStateHelper<Scalar, IndexTraits>::computeAddbackEfficiency_(const std::vector<std::string>& chain,
+GroupStateHelper<Scalar, IndexTraits>::computeAddbackEfficiency_(const GroupChain& chain,
                                                                  const std::size_t local_reduction_level) const
 {
     // Compute partial efficiency factor from local_reduction_level down to the entity.
@@ -1893,7 +1899,9 @@ GroupStateHelper<Scalar, IndexTraits>::computeAddbackEfficiency_(const std::vect
     Scalar efficiency = 1.0;
     for (std::size_t jj = local_reduction_level + 1; jj <= num_ancestors; ++jj) {
         const std::string& name = chain[jj];
-        if (this->schedule_.hasGroup(name, this->report_step_)) {
+        if (const int group_idx = chain.groupIndex(jj); group_idx != GroupTopology::InvalidIndex) {
+            efficiency *= this->group_topology_.groupEfficiencyFactor(group_idx);
+        } else if (this->schedule_.hasGroup(name, this->report_step_)) {
             const auto& grp = this->schedule_.getGroup(name, this->report_step_);
             efficiency *= grp.getGroupEfficiencyFactor();
         } else if (this->schedule_.hasWell(name, this->report_step_)) {
@@ -1905,13 +1913,27 @@ GroupStateHelper<Scalar, IndexTraits>::computeAddbackEfficiency_(const std::vect
     return efficiency;
 }
 
+// Called from checkGroupConstraintsInj() and checkGroupConstraintsProd().
+// - Efficiency factor of a group in the chain, without a Schedule lookup if the
+//   chain comes from the group topology.
+template <typename Scalar, typename IndexTraits>
+Scalar
+GroupStateHelper<Scalar, IndexTraits>::chainGroupEfficiencyFactor_(const GroupChain& chain,
+                                                                   const std::size_t level) const
+{
+    if (const int group_idx = chain.groupIndex(level); group_idx != GroupTopology::InvalidIndex) {
+        return this->group_topology_.groupEfficiencyFactor(group_idx);
+    }
+    return this->schedule_.getGroup(chain[level], this->report_step_).getGroupEfficiencyFactor();
+}
+
 // Called from the same public methods as applyReductionsAndFractions_().
 // - Finds the deepest group level with both a guide rate and group-controlled wells.
 // - This is the level where the bottom group's reduction rate must be added back to the target
 //   when it is about to switch from individual control to higher level group control.
 template <typename Scalar, typename IndexTraits>
 std::size_t
-GroupStateHelper<Scalar, IndexTraits>::getLocalReductionLevel_(const std::vector<std::string>& chain,
+GroupStateHelper<Scalar, IndexTraits>::getLocalReductionLevel_(const GroupChain& chain,
                                                                const bool is_production_group,
                                                                const Phase injection_phase) const
 {
@@ -2223,6 +2245,10 @@ bool
 GroupStateHelper<Scalar, IndexTraits>::isInGroupChainTopBot_(const std::string& bottom,
                                                             const std::string& top) const
 {
+    if (const auto isInChain = this->group_topology_.isInChainTopBot(bottom, top)) {
+        return *isInChain;
+    }
+
     // Get initial parent, 'bottom' can be a well or a group.
     std::string parent;
     if (this->schedule_.hasWell(bottom, this->report_step_)) {
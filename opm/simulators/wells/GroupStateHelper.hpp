@@ -35,11 +35,16 @@
 #include <opm/simulators/utils/gatherDeferredLogger.hpp>
 #include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
 #include <opm/simulators/wells/GroupState.hpp>
+#include <opm/simulators/wells/GroupTopology.hpp>
 #include <opm/simulators/wells/VFPProdProperties.hpp>
 #include <opm/simulators/wells/WellState.hpp>
 
 #include <opm/simulators/utils/ParallelCommunication.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <algorithm>
 #include <map>
 #include <memory>
@@ -135,10 +140,10 @@ public:
         ///        possible (e.g., NLDD domain-local operations).
         explicit ScopedLoggerGuard(const GroupStateHelper& helper, bool do_mpi_gather = true)
             : helper_(&helper)
-            , previous_(helper.deferred_logger_)
+            , previous_(helper.loggerSlot())
             , do_mpi_gather_(do_mpi_gather)
         {
-            helper_->deferred_logger_ = &logger_;
+            helper_->loggerSlot() = &logger_;
         }
 
         ~ScopedLoggerGuard()
@@ -155,12 +160,15 @@ public:
                 } else {
                     // Just log locally without MPI gather
                     if (helper_->terminalOutput()) {
+#ifdef _OPENMP
+#pragma omp critical(GroupStateHelperLogMessages)
+#endif
                         logger_.logMessages();
                     }
                 }
 
                 // 3. Restore previous logger
-                helper_->deferred_logger_ = previous_;
+                helper_->loggerSlot() = previous_;
             }
         }
 
@@ -179,7 +187,7 @@ public:
         {
             // Update the helper's pointer to our moved logger
             if (helper_) {
-                helper_->deferred_logger_ = &logger_;
+                helper_->loggerSlot() = &logger_;
             }
             other.helper_ = nullptr;
             other.previous_ = nullptr;
@@ -232,10 +240,11 @@ public:
     /// @throws std::logic_error if no logger has been set via pushLogger()
     DeferredLogger& deferredLogger() const
     {
-        if (this->deferred_logger_ == nullptr) {
+        auto* logger = threadLogger() ? threadLogger() : this->deferred_logger_;
+        if (logger == nullptr) {
             throw std::logic_error("DeferredLogger not set. Call pushLogger() first.");
         }
-        return *this->deferred_logger_;
+        return *logger;
     }
 
     std::vector<Scalar> getGroupRatesAvailableForHigherLevelControl(const Group& group, const bool is_injector) const;
@@ -289,7 +298,7 @@ public:
 
     GuideRate::RateVector getWellRateVector(const std::string& name) const;
 
-    std::vector<std::string> groupChainTopBot(const std::string& bottom, const std::string& top) const;
+    GroupChain groupChainTopBot(const std::string& bottom, const std::string& top) const;
 
     /// returns the number of wells that are actively under group control for a given group with name given
     /// by group_name
@@ -413,6 +422,13 @@ public:
     void setReportStep(int report_step)
     {
         report_step_ = report_step;
+        // The group tree may change between report steps (GRUPTREE, WELSPECS, ACTIONX).
+        group_topology_ = GroupTopology{schedule_, static_cast<std::size_t>(report_step)};
+    }
+
+    const GroupTopology& groupTopology() const
+    {
+        return this->group_topology_;
     }
 
     const SummaryState& summaryState() const
@@ -535,7 +551,7 @@ private:
     //! \param do_addback Whether to perform add-back at local_reduction_level
     //! \return Target after applying reductions and fractions (before efficiency factor division)
     template<typename ReductionLambda, typename FractionLambda>
-    Scalar applyReductionsAndFractions_(const std::vector<std::string>& chain,
+    Scalar applyReductionsAndFractions_(const GroupChain& chain,
                                         Scalar orig_target,
                                         Scalar current_rate_available,
                                         std::size_t local_reduction_level,
@@ -571,9 +587,12 @@ private:
     //! \param chain The group chain from control group (top) to entity (bottom)
     //! \param local_reduction_level The level at which addback is applied
     //! \return The partial efficiency factor for addback
-    Scalar computeAddbackEfficiency_(const std::vector<std::string>& chain,
+    Scalar computeAddbackEfficiency_(const GroupChain& chain,
                                      std::size_t local_reduction_level) const;
 
+    //! \brief Efficiency factor (GEFAC) of the group at a level of the chain.
+    Scalar chainGroupEfficiencyFactor_(const GroupChain& chain, std::size_t level) const;
+
     std::string controlGroup_(const Group& group) const;
 
     GuideRate::RateVector getGuideRateVector_(const std::vector<Scalar>& rates) const;
@@ -593,7 +612,7 @@ private:
     //! \param is_production_group True for production, false for injection
     //! \param injection_phase Phase for injection groups (ignored for production)
     //! \return The local reduction level (0 if no intermediate group qualifies)
-    std::size_t getLocalReductionLevel_(const std::vector<std::string>& chain,
+    std::size_t getLocalReductionLevel_(const GroupChain& chain,
         bool is_production_group,
         Phase injection_phase) const;
 
@@ -718,12 +737,35 @@ private:
     // NOTE: The deferred logger does not change the object "meaningful" state, so it should be ok to
     //   make it mutable and store a pointer to it here.
     mutable DeferredLogger* deferred_logger_ {nullptr};
+
+    /// @brief Logger pushed by the calling thread inside an OpenMP parallel region
+    ///
+    /// @details Concurrent NLDD domain solves push their loggers here, so that they
+    /// do not replace each other's logger in deferred_logger_. Outside parallel
+    /// regions, and for threads that did not push a logger, deferred_logger_ is used.
+    static DeferredLogger*& threadLogger()
+    {
+        static thread_local DeferredLogger* logger = nullptr;
+        return logger;
+    }
+
+    /// @brief Where ScopedLoggerGuard installs its logger for the calling thread
+    DeferredLogger*& loggerSlot() const
+    {
+#ifdef _OPENMP
+        if (omp_in_parallel()) {
+            return threadLogger();
+        }
+#endif
+        return this->deferred_logger_;
+    }
     // NOTE: The phase usage info seems to be read-only throughout the simulation, so it should be safe
     // to store a reference to it here.
     const PhaseUsageInfo<IndexTraits>& phase_usage_info_;
     const Parallel::Communication& comm_;
     bool terminal_output_ {false};
     int report_step_ {0};
+    GroupTopology group_topology_{};
     ReservoirCoupling::Proxy<Scalar> rescoup_{};
 };
 
@@ -0,0 +1,155 @@
+/*
+  Copyright 2025 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+#include <opm/simulators/wells/GroupTopology.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <opm/input/eclipse/Schedule/Group/Group.hpp>
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/Well/Well.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace Opm {
+
+GroupTopology::GroupTopology(const Schedule& schedule, const std::size_t report_step)
+    : report_step_(report_step)
+    , group_names_(schedule.groupNames(report_step))
+    , well_names_(schedule.wellNames(report_step))
+{
+    const auto num_groups = this->group_names_.size();
+    const auto num_wells = this->well_names_.size();
+
+    this->group_index_.reserve(num_groups);
+    for (std::size_t g = 0; g < num_groups; ++g) {
+        this->group_index_.emplace(this->group_names_[g], static_cast<int>(g));
+    }
+    this->well_index_.reserve(num_wells);
+    for (std::size_t w = 0; w < num_wells; ++w) {
+        this->well_index_.emplace(this->well_names_[w], static_cast<int>(w));
+    }
+
+    this->group_parent_.resize(num_groups, InvalidIndex);
+    this->group_efficiency_.resize(num_groups, 1.0);
+    for (std::size_t g = 0; g < num_groups; ++g) {
+        const auto& group = schedule.getGroup(this->group_names_[g], report_step);
+        // FIELD has an empty parent name and therefore no parent index.
+        this->group_parent_[g] = this->groupIndex(group.parent());
+        this->group_efficiency_[g] = group.getGroupEfficiencyFactor();
+    }
+
+    this->well_group_.resize(num_wells, InvalidIndex);
+    for (std::size_t w = 0; w < num_wells; ++w) {
+        const auto& well = schedule.getWell(this->well_names_[w], report_step);
+        this->well_group_[w] = this->groupIndex(well.groupName());
+    }
+
+    this->ancestor_offsets_.reserve(num_groups + 1);
+    this->ancestor_offsets_.push_back(0);
+    for (std::size_t g = 0; g < num_groups; ++g) {
+        std::size_t depth = 0;
+        for (int a = static_cast<int>(g); a != InvalidIndex; a = this->group_parent_[a]) {
+            if (++depth > num_groups) {
+                OPM_THROW(std::logic_error,
+                          "Group tree contains a cycle involving group " + this->group_names_[g]);
+            }
+            this->ancestors_.push_back(a);
+        }
+        this->ancestor_offsets_.push_back(this->ancestors_.size());
+    }
+}
+
+int GroupTopology::groupIndex(const std::string& name) const
+{
+    const auto it = this->group_index_.find(name);
+    return it == this->group_index_.end() ? InvalidIndex : it->second;
+}
+
+int GroupTopology::wellIndex(const std::string& name) const
+{
+    const auto it = this->well_index_.find(name);
+    return it == this->well_index_.end() ? InvalidIndex : it->second;
+}
+
+std::optional<GroupTopology::Bottom>
+GroupTopology::bottom_(const std::string& bottom) const
+{
+    // 'bottom' can be a well or a group.
+    if (const int w = this->wellIndex(bottom); w != InvalidIndex) {
+        const int parent = this->well_group_[w];
+        if (parent == InvalidIndex) {
+            return std::nullopt;
+        }
+        return Bottom{this->groupAncestors(parent), &this->well_names_[w]};
+    }
+    if (const int g = this->groupIndex(bottom); g != InvalidIndex) {
+        const int parent = this->group_parent_[g];
+        // FIELD has no ancestors.
+        return Bottom{parent == InvalidIndex ? std::span<const int>{} : this->groupAncestors(parent),
+                      &this->group_names_[g]};
+    }
+    return std::nullopt;
+}
+
+std::optional<GroupChain>
+GroupTopology::chainTopBot(const std::string& bottom, const std::string& top) const
+{
+    const int top_idx = this->groupIndex(top);
+    const auto bot = this->bottom_(bottom);
+    if (top_idx == InvalidIndex || !bot.has_value()) {
+        return std::nullopt;
+    }
+
+    const auto& ancestors = bot->parent_ancestors;
+    const auto it = std::ranges::find(ancestors, top_idx);
+    if (it == ancestors.end()) {
+        return std::nullopt;
+    }
+
+    // Ancestors are stored bottom-up, GroupChain reverses them.
+    const auto length = static_cast<std::size_t>(std::distance(ancestors.begin(), it)) + 1;
+    return GroupChain{*this, ancestors.first(length), *bot->name};
+}
+
+std::optional<bool>
+GroupTopology::isInChainTopBot(const std::string& bottom, const std::string& top) const
+{
+    const int top_idx = this->groupIndex(top);
+    const auto bot = this->bottom_(bottom);
+    if (top_idx == InvalidIndex || !bot.has_value()) {
+        return std::nullopt;
+    }
+    return std::ranges::find(bot->parent_ancestors, top_idx) != bot->parent_ancestors.end();
+}
+
+std::vector<std::string> GroupChain::names() const
+{
+    std::vector<std::string> names;
+    names.reserve(this->size());
+    for (std::size_t i = 0; i < this->size(); ++i) {
+        names.push_back((*this)[i]);
+    }
+    return names;
+}
+
+} // namespace Opm
@@ -0,0 +1,217 @@
+/*
+  Copyright 2025 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_GROUP_TOPOLOGY_HEADER_INCLUDED
+#define OPM_GROUP_TOPOLOGY_HEADER_INCLUDED
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+class GroupTopology;
+class Schedule;
+
+/// Chain of groups from a top group down to a well or group (the bottom).
+///
+/// Element 0 is the top group and the last element is the bottom. A chain
+/// returned by GroupTopology::chainTopBot() refers to the names and indices
+/// of the topology without copying them, so it must not outlive it. Chains
+/// not covered by a topology own their names instead.
+class GroupChain
+{
+public:
+    /// Chain owning its names, ordered from top to bottom.
+    explicit GroupChain(std::vector<std::string> names)
+        : names_(std::move(names))
+    {}
+
+    std::size_t size() const
+    {
+        return this->topology_ ? this->groups_.size() + 1 : this->names_.size();
+    }
+
+    const std::string& operator[](std::size_t i) const;
+
+    /// Dense index of the group at position i in the topology, or
+    /// InvalidIndex for the bottom and for chains owning their names.
+    int groupIndex(std::size_t i) const;
+
+    /// Copy of the names, ordered from top to bottom.
+    std::vector<std::string> names() const;
+
+private:
+    friend class GroupTopology;
+
+    GroupChain(const GroupTopology& topology,
+               std::span<const int> groups,
+               const std::string& bottom)
+        : topology_(&topology)
+        , groups_(groups)
+        , bottom_(&bottom)
+    {}
+
+    const GroupTopology* topology_{nullptr};
+    // Ancestors of the bottom from its parent up to the top, i.e. reversed.
+    std::span<const int> groups_{};
+    const std::string* bottom_{nullptr};
+    std::vector<std::string> names_{};
+};
+
+/// Compiled form of the group tree at one report step.
+///
+/// Groups and wells are given dense indices and the parent relations are
+/// stored in flat arrays. For every group the chain of ancestors up to and
+/// including FIELD is precomputed, so walking the tree from a well or group
+/// to a controlling group does not require any lookups in the Schedule.
+///
+/// The topology is built once per report step (the group tree cannot change
+/// within a report step) and is used by GroupStateHelper to answer the
+/// name-based chain queries.
+class GroupTopology
+{
+public:
+    static constexpr int InvalidIndex = -1;
+
+    GroupTopology() = default;
+
+    /// Build the topology of the groups and wells defined at report_step.
+    GroupTopology(const Schedule& schedule, std::size_t report_step);
+
+    /// Report step the topology was built for, or nullopt for an empty topology.
+    std::optional<std::size_t> reportStep() const
+    {
+        return this->report_step_;
+    }
+
+    int numGroups() const
+    {
+        return static_cast<int>(this->group_names_.size());
+    }
+
+    int numWells() const
+    {
+        return static_cast<int>(this->well_names_.size());
+    }
+
+    /// Dense index of the group, or InvalidIndex if there is no such group.
+    int groupIndex(const std::string& name) const;
+
+    /// Dense index of the well, or InvalidIndex if there is no such well.
+    int wellIndex(const std::string& name) const;
+
+    const std::string& groupName(int group_idx) const
+    {
+        return this->group_names_[group_idx];
+    }
+
+    const std::string& wellName(int well_idx) const
+    {
+        return this->well_names_[well_idx];
+    }
+
+    /// Index of the parent group, InvalidIndex for FIELD.
+    int groupParent(int group_idx) const
+    {
+        return this->group_parent_[group_idx];
+    }
+
+    /// Index of the group the well belongs to.
+    int wellGroup(int well_idx) const
+    {
+        return this->well_group_[well_idx];
+    }
+
+    /// Efficiency factor (GEFAC) of the group.
+    double groupEfficiencyFactor(int group_idx) const
+    {
+        return this->group_efficiency_[group_idx];
+    }
+
+    /// The group itself followed by all of its ancestors, ending with FIELD.
+    std::span<const int> groupAncestors(int group_idx) const
+    {
+        const auto begin = this->ancestor_offsets_[group_idx];
+        const auto end = this->ancestor_offsets_[group_idx + 1];
+        return {this->ancestors_.data() + begin, end - begin};
+    }
+
+    /// Chain from top down to bottom (a well or a group), both included.
+    /// Returns nullopt if bottom or top are unknown or if top is not above
+    /// bottom in the tree.
+    std::optional<GroupChain>
+    chainTopBot(const std::string& bottom, const std::string& top) const;
+
+    /// Whether top is a strict ancestor of bottom (a well or a group).
+    /// Returns nullopt if bottom or top are unknown.
+    std::optional<bool> isInChainTopBot(const std::string& bottom, const std::string& top) const;
+
+private:
+    struct Bottom
+    {
+        std::span<const int> parent_ancestors;
+        const std::string* name;
+    };
+
+    /// Ancestors of the parent group of bottom and the stored name of bottom,
+    /// or nullopt if bottom is unknown.
+    std::optional<Bottom> bottom_(const std::string& bottom) const;
+
+    std::optional<std::size_t> report_step_{};
+
+    std::vector<std::string> group_names_{};
+    std::vector<std::string> well_names_{};
+    std::unordered_map<std::string, int> group_index_{};
+    std::unordered_map<std::string, int> well_index_{};
+
+    std::vector<int> group_parent_{};
+    std::vector<int> well_group_{};
+    std::vector<double> group_efficiency_{};
+
+    // CSR layout: ancestors_[ancestor_offsets_[g] .. ancestor_offsets_[g+1])
+    std::vector<std::size_t> ancestor_offsets_{};
+    std::vector<int> ancestors_{};
+};
+
+inline const std::string& GroupChain::operator[](const std::size_t i) const
+{
+    if (!this->topology_) {
+        return this->names_[i];
+    }
+    return i == this->groups_.size()
+        ? *this->bottom_
+        : this->topology_->groupName(this->groups_[this->groups_.size() - 1 - i]);
+}
+
+inline int GroupChain::groupIndex(const std::size_t i) const
+{
+    if (!this->topology_ || i >= this->groups_.size()) {
+        return GroupTopology::InvalidIndex;
+    }
+    return this->groups_[this->groups_.size() - 1 - i];
+}
+
+} // namespace Opm
+
+#endif // OPM_GROUP_TOPOLOGY_HEADER_INCLUDED
@@ -135,6 +135,15 @@ init(const int numPerfs,
 
     // Store the global index of well perforated cells
     cells_ = cells;
+
+    std::vector<int> outlets(well_.numberOfSegments(), -1);
+    for (int seg = 0; seg < well_.numberOfSegments(); ++seg) {
+        const int outlet_segment_number = well_.segmentSet()[seg].outletSegment();
+        if (outlet_segment_number > 0) {
+            outlets[seg] = well_.segmentNumberToIndex(outlet_segment_number);
+        }
+    }
+    treeSolver_.init(outlets);
 }
 
 template<class Scalar, typename IndexTraits, int numWellEq, int numEq>
@@ -147,6 +156,7 @@ void MultisegmentWellEquations<Scalar, IndexTraits, numWellEq, numEq>::clear()
     if constexpr (std::is_same_v<Scalar,double>) {
         duneDSolver_.reset();
     }
+    treeSolver_.reset();
 }
 
 template<class Scalar, typename IndexTraits, int numWellEq, int numEq>
@@ -162,7 +172,7 @@ apply(const BVector& x, BVector& Ax) const
     // the single process to complete the computation.
     // invDBx = duneD^-1 * Bx_
     if constexpr (std::is_same_v<Scalar,double>) {
-        const BVectorWell invDBx = mswellhelpers::applyUMFPack(*duneDSolver_, Bx);
+        const BVectorWell invDBx = applyInvD(Bx);
         // Ax.size() == 0 indicates that there are no active perforations on this process.
         // Then, Ax does not need to be updated by the following calculation.
         if (Ax.size() > 0) {
@@ -184,7 +194,7 @@ apply(BVector& r) const
             // because the other processes would remain idle while waiting for
             // the single process to complete the computation.
             // invDrw_ = duneD^-1 * resWell_
-            const BVectorWell invDrw = mswellhelpers::applyUMFPack(*duneDSolver_, resWell_);
+            const BVectorWell invDrw = applyInvD(resWell_);
             // r = r - duneC_^T * invDrw
             duneC_.mmtv(invDrw, r);
         }
@@ -199,7 +209,13 @@ void MultisegmentWellEquations<Scalar, IndexTraits, numWellEq, numEq>::createSol
         OPM_THROW(std::runtime_error, "MultisegmentWell support requires UMFPACK, "
                                       "and UMFPACK does not support float");
     } else {
-        if (duneDSolver_) {
+        if (duneDSolver_ || treeSolver_.isFactorized()) {
+            return;
+        }
+        // The segments form a tree which is eliminated from the inlets to the
+        // top segment without fill-in, in linear time. UMFPack is the fallback
+        // if a pivot block is singular, as it pivots across segments.
+        if (treeSolver_.factorize(duneD_)) {
             return;
         }
         duneDSolver_ = std::make_shared<Dune::UMFPack<DiagMatWell>>(duneD_, 0);
@@ -218,7 +234,7 @@ MultisegmentWellEquations<Scalar, IndexTraits, numWellEq, numEq>::solve() const
         // It is ok to do this on each process instead of only on one,
         // because the other processes would remain idle while waiting for
         // the single process to complete the computation.
-        return mswellhelpers::applyUMFPack(*duneDSolver_, resWell_);
+        return applyInvD(resWell_);
     }
     else {
        return {};
@@ -233,6 +249,22 @@ MultisegmentWellEquations<Scalar, IndexTraits, numWellEq, numEq>::solve(const BV
         // It is ok to do this on each process instead of only on one,
         // because the other processes would remain idle while waiting for
         // the single process to complete the computation.
+        return applyInvD(rhs);
+    }
+    else {
+        return {};
+    }
+}
+
+template<class Scalar, typename IndexTraits, int numWellEq, int numEq>
+typename MultisegmentWellEquations<Scalar, IndexTraits, numWellEq, numEq>::BVectorWell
+MultisegmentWellEquations<Scalar, IndexTraits, numWellEq, numEq>::
+applyInvD(const BVectorWell& rhs) const
+{
+    if (treeSolver_.isFactorized()) {
+        return treeSolver_.solve(rhs);
+    }
+    if constexpr (std::is_same_v<Scalar,double>) {
         return mswellhelpers::applyUMFPack(*duneDSolver_, rhs);
     }
     else {
@@ -253,7 +285,7 @@ recoverSolutionWell(const BVector& x, BVectorWell& xw) const
         // It is ok to do this on each process instead of only on one,
         // because the other processes would remain idle while waiting for
         // the single process to complete the computation.
-        xw = mswellhelpers::applyUMFPack(*duneDSolver_, resWell);
+        xw = applyInvD(resWell);
     }
 }
 
@@ -333,9 +365,11 @@ void MultisegmentWellEquations<Scalar, IndexTraits, numWellEq, numEq>::
 extract(SparseMatrixAdapter& jacobian) const
 {
     if constexpr (std::is_same_v<Scalar,double>) {
-        const auto invDuneD = mswellhelpers::invertWithUMFPack<BVectorWell>(duneD_.M(),
-                                                                            numWellEq,
-                                                                            *duneDSolver_);
+        const auto invDuneD = treeSolver_.isFactorized()
+            ? treeSolver_.inverse()
+            : mswellhelpers::invertWithUMFPack<BVectorWell>(duneD_.M(),
+                                                            numWellEq,
+                                                            *duneDSolver_);
 
         // We need to change matrix A as follows
         // A -= C^T D^-1 B
@@ -25,6 +25,7 @@
 #include <opm/simulators/utils/ParallelCommunication.hpp>
 #include <opm/simulators/wells/ParallelWellInfo.hpp>
 #include <opm/simulators/wells/MSWellHelpers.hpp>
+#include <opm/simulators/wells/MultisegmentWellTreeSolver.hpp>
 #include <dune/common/fmatrix.hh>
 #include <dune/common/fvector.hh>
 #include <dune/istl/bcrsmatrix.hh>
@@ -95,6 +96,8 @@ public:
     void apply(BVector& r) const;
 
     //! \brief Compute the LU-decomposition of D matrix.
+    //! \details The segment tree is eliminated directly, UMFPack is only
+    //!          used if that fails due to a singular pivot block.
     void createSolver();
 
     //! \brief Apply inverted D matrix to residual and return result.
@@ -137,6 +140,10 @@ public:
 
   private:
     friend class MultisegmentWellEquationAccess<Scalar,IndexTraits,numWellEq,numEq>;
+
+    //! \brief Apply inverted D matrix to rhs using the factorized solver.
+    BVectorWell applyInvD(const BVectorWell& rhs) const;
+
     // two off-diagonal matrices
     OffDiagMatWell duneB_;
     OffDiagMatWell duneC_;
@@ -152,6 +159,12 @@ public:
                                              EmptyType>; // TODO: c++20: add no_unique_address
     mutable UMFPackSolver duneDSolver_;
 
+    /// \brief Block elimination of D along the segment tree.
+    ///
+    /// The elimination order is set up in init() and thus only changes
+    /// with the segment structure.
+    MultisegmentWellTreeSolver<Scalar,numWellEq> treeSolver_;
+
     // residuals of the well equations
     BVectorWell resWell_;
 
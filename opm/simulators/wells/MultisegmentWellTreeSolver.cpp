@@ -0,0 +1,199 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+#include <opm/simulators/wells/MultisegmentWellTreeSolver.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/common/Exceptions.hpp>
+#include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/TimingMacros.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <string>
+
+namespace Opm {
+
+template<class Scalar, int numWellEq>
+bool MultisegmentWellTreeSolver<Scalar, numWellEq>::
+init(const std::vector<int>& outlets)
+{
+    const int numSegments = outlets.size();
+    outlet_ = outlets;
+    order_.clear();
+    order_.reserve(numSegments);
+    factorized_ = false;
+
+    std::vector<std::vector<int>> inlets(numSegments);
+    for (int seg = 0; seg < numSegments; ++seg) {
+        if (outlet_[seg] < 0) {
+            order_.push_back(seg);
+        } else {
+            inlets[outlet_[seg]].push_back(seg);
+        }
+    }
+
+    // Breadth first from the top segment(s). Reversed, every segment
+    // comes after all of its inlets.
+    for (std::size_t i = 0; i < order_.size(); ++i) {
+        for (const int inlet : inlets[order_[i]]) {
+            order_.push_back(inlet);
+        }
+    }
+    if (static_cast<int>(order_.size()) != numSegments) {
+        // The outlets contain a cycle.
+        order_.clear();
+        return false;
+    }
+    std::reverse(order_.begin(), order_.end());
+
+    invPivot_.resize(numSegments);
+    lower_.resize(numSegments);
+    upper_.resize(numSegments);
+    return true;
+}
+
+template<class Scalar, int numWellEq>
+bool MultisegmentWellTreeSolver<Scalar, numWellEq>::
+factorize(const Matrix& D)
+{
+    OPM_TIMEFUNCTION();
+    factorized_ = false;
+    if (order_.size() != D.N()) {
+        return false;
+    }
+
+    for (std::size_t seg = 0; seg < D.N(); ++seg) {
+        invPivot_[seg] = D[seg][seg];
+    }
+
+    for (const int seg : order_) {
+        // All inlets have been eliminated, invPivot_[seg] holds the
+        // Schur complement of the diagonal block.
+        try {
+            invPivot_[seg].invert();
+        }
+        catch (const Dune::FMatrixError&) {
+            return false;
+        }
+
+        const int outlet = outlet_[seg];
+        if (outlet >= 0) {
+            const auto upper = D[seg].find(outlet);
+            const auto lower = D[outlet].find(seg);
+            if (upper == D[seg].end() || lower == D[outlet].end()) {
+                return false;
+            }
+            upper_[seg] = *upper;
+            lower_[seg] = *lower;
+            lower_[seg].rightmultiply(invPivot_[seg]);
+            BlockType update = lower_[seg];
+            update.rightmultiply(upper_[seg]);
+            invPivot_[outlet] -= update;
+        }
+    }
+
+    factorized_ = true;
+    return true;
+}
+
+template<class Scalar, int numWellEq>
+typename MultisegmentWellTreeSolver<Scalar, numWellEq>::Vector
+MultisegmentWellTreeSolver<Scalar, numWellEq>::
+solve(Vector rhs) const
+{
+    assert(factorized_);
+
+    // forward elimination from the inlets towards the top segment
+    for (const int seg : order_) {
+        const int outlet = outlet_[seg];
+        if (outlet >= 0) {
+            lower_[seg].mmv(rhs[seg], rhs[outlet]);
+        }
+    }
+
+    // back substitution from the top segment towards the inlets
+    typename Vector::block_type tmp;
+    for (auto it = order_.rbegin(); it != order_.rend(); ++it) {
+        const int seg = *it;
+        const int outlet = outlet_[seg];
+        if (outlet >= 0) {
+            upper_[seg].mmv(rhs[outlet], rhs[seg]);
+        }
+        invPivot_[seg].mv(rhs[seg], tmp);
+        rhs[seg] = tmp;
+    }
+
+    // Same check as for the UMFPack solve in mswellhelpers::applyUMFPack().
+    for (const auto& block : rhs) {
+        for (const auto& value : block) {
+            if (!std::isfinite(value)) {
+                const std::string msg{"nan or inf value found after segment tree solve due to singular matrix"};
+                OpmLog::debug(msg);
+                OPM_THROW_NOLOG(NumericalProblem, msg);
+            }
+        }
+    }
+    return rhs;
+}
+
+template<class Scalar, int numWellEq>
+Dune::Matrix<typename MultisegmentWellTreeSolver<Scalar, numWellEq>::BlockType>
+MultisegmentWellTreeSolver<Scalar, numWellEq>::
+inverse() const
+{
+    const int size = order_.size();
+    Vector e(size);
+    e = 0.0;
+
+    // Make a full block matrix.
+    Dune::Matrix<BlockType> inv(size, size);
+
+    // Create inverse by solving for the basis vectors.
+    for (int ii = 0; ii < size; ++ii) {
+        for (int jj = 0; jj < numWellEq; ++jj) {
+            e[ii][jj] = 1.0;
+            const auto col = solve(e);
+            for (int cc = 0; cc < size; ++cc) {
+                for (int dd = 0; dd < numWellEq; ++dd) {
+                    inv[cc][ii][dd][jj] = col[cc][dd];
+                }
+            }
+            e[ii][jj] = 0.0;
+        }
+    }
+
+    return inv;
+}
+
+#define INSTANTIATE_TYPE(T)                         \
+    template class MultisegmentWellTreeSolver<T,2>; \
+    template class MultisegmentWellTreeSolver<T,3>; \
+    template class MultisegmentWellTreeSolver<T,4>;
+
+INSTANTIATE_TYPE(double)
+
+#if FLOW_INSTANTIATE_FLOAT
+INSTANTIATE_TYPE(float)
+#endif
+
+} // namespace Opm
@@ -0,0 +1,96 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_MULTISEGMENTWELL_TREE_SOLVER_HEADER_INCLUDED
+#define OPM_MULTISEGMENTWELL_TREE_SOLVER_HEADER_INCLUDED
+
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+#include <dune/istl/matrix.hh>
+
+#include <vector>
+
+namespace Opm
+{
+
+/// \brief Direct solver for the segment matrix D of a multisegment well.
+///
+/// The segments of a well form a tree in which each segment is coupled
+/// to its outlet and its inlets only. Eliminating the segments from the
+/// leaves towards the top segment therefore produces no fill-in, and the
+/// block LU factorization and the solves are linear in the number of
+/// segments. The elimination order only depends on the segment topology
+/// and is computed once by init(), while factorize() is called whenever
+/// the entries of D change. No pivoting is done across segments.
+template<class Scalar, int numWellEq>
+class MultisegmentWellTreeSolver
+{
+public:
+    using BlockType = Dune::FieldMatrix<Scalar,numWellEq,numWellEq>;
+    using Matrix = Dune::BCRSMatrix<BlockType>;
+    using Vector = Dune::BlockVector<Dune::FieldVector<Scalar,numWellEq>>;
+
+    //! \brief Compute the elimination order.
+    //! \param outlets The outlet segment index of each segment, -1 for the top segment.
+    //! \return False if the outlets do not form a tree.
+    bool init(const std::vector<int>& outlets);
+
+    //! \brief Compute the block LU factorization of D.
+    //! \details D must have the sparsity pattern given by the outlets.
+    //! \return False if a pivot block is singular.
+    bool factorize(const Matrix& D);
+
+    //! \brief Whether factorize() has succeeded since the last call to reset().
+    bool isFactorized() const
+    {
+        return factorized_;
+    }
+
+    //! \brief Mark the factorization as outdated.
+    void reset()
+    {
+        factorized_ = false;
+    }
+
+    //! \brief Return the solution of D x = rhs.
+    //! \details Throws NumericalProblem if the solution is not finite.
+    Vector solve(Vector rhs) const;
+
+    //! \brief Return D^-1 as a full block matrix.
+    Dune::Matrix<BlockType> inverse() const;
+
+private:
+    //! \brief Outlet of each segment, -1 for the top segment.
+    std::vector<int> outlet_;
+    //! \brief Segments ordered such that inlets precede their outlet.
+    std::vector<int> order_;
+    //! \brief Inverse of the eliminated diagonal block of each segment.
+    std::vector<BlockType> invPivot_;
+    //! \brief D(outlet, seg) * invPivot_(seg) for each segment.
+    std::vector<BlockType> lower_;
+    //! \brief D(seg, outlet) for each segment.
+    std::vector<BlockType> upper_;
+    bool factorized_ = false;
+};
+
+} // namespace Opm
+
+#endif // OPM_MULTISEGMENTWELL_TREE_SOLVER_HEADER_INCLUDED
@@ -29,6 +29,7 @@
 #include <opm/input/eclipse/Schedule/VFPInjTable.hpp>
 #include <opm/input/eclipse/Schedule/VFPProdTable.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <stdexcept>
@@ -83,6 +84,15 @@ namespace Opm {
 template<class Scalar>
 detail::InterpData<Scalar> VFPHelpers<Scalar>::findInterpData(const Scalar value_in,
                                                               const std::vector<double>& values)
+{
+    int hint = 1;
+    return findInterpData(value_in, values, hint);
+}
+
+template<class Scalar>
+detail::InterpData<Scalar> VFPHelpers<Scalar>::findInterpData(const Scalar value_in,
+                                                              const std::vector<double>& values,
+                                                              int& hint)
 {
     detail::InterpData<Scalar> retval;
 
@@ -112,14 +122,28 @@ detail::InterpData<Scalar> VFPHelpers<Scalar>::findInterpData(const Scalar value
             retval.ind_[1] = nvalues-1;
         }
         else {
-            //Search internal intervals
-            for (int i=1; i<nvalues; ++i) {
-                if (values[i] >= value) {
-                    retval.ind_[0] = i-1;
-                    retval.ind_[1] = i;
-                    break;
+            //Search internal intervals for the first i >= 1 with values[i] >= value,
+            //starting with the previous interval and its neighbours
+            const auto isUpper = [&values, value, nvalues](const int i)
+            {
+                return i >= 1 && i < nvalues && values[i] >= value &&
+                       (i == 1 || values[i-1] < value);
+            };
+            int i = hint;
+            if (!isUpper(i)) {
+                if (isUpper(hint+1)) {
+                    i = hint+1;
+                }
+                else if (isUpper(hint-1)) {
+                    i = hint-1;
+                }
+                else {
+                    i = std::lower_bound(values.begin() + 1, values.end(), value) - values.begin();
                 }
             }
+            hint = i;
+            retval.ind_[0] = i-1;
+            retval.ind_[1] = i;
         }
 
         const Scalar start = values[retval.ind_[0]];
@@ -620,6 +644,148 @@ intersectWithIPR(const VFPProdTable& table,
     }
 }
 
+template<class Scalar>
+VFPProdEvaluator<Scalar>::
+VFPProdEvaluator(const VFPProdTable& table,
+                 const Scalar thp,
+                 const Scalar alq)
+    : table_(table)
+    , thp_i_(VFPHelpers<Scalar>::findInterpData(thp, table.getTHPAxis()))
+    , alq_i_(VFPHelpers<Scalar>::findInterpData(alq, table.getALQAxis()))
+{
+}
+
+template<class Scalar>
+detail::VFPEvaluation<Scalar> VFPProdEvaluator<Scalar>::
+bhp(const Scalar aqua,
+    const Scalar liquid,
+    const Scalar vapour,
+    const Scalar explicit_wfr,
+    const Scalar explicit_gfr,
+    const bool   use_vfpexplicit)
+{
+    // Same choice of wfr and gfr as in VFPHelpers::bhp()
+    const Scalar flo = detail::getFlo(table_, aqua, liquid, vapour);
+    Scalar wfr = detail::getWFR(table_, aqua, liquid, vapour);
+    Scalar gfr = detail::getGFR(table_, aqua, liquid, vapour);
+    if (use_vfpexplicit || -flo < table_.getFloAxis().front()) {
+        wfr = explicit_wfr;
+        gfr = explicit_gfr;
+    }
+
+    //Recall that flo is negative in Opm, so switch sign.
+    return interpolate(-flo, wfr, gfr);
+}
+
+template<class Scalar>
+std::vector<Scalar> VFPProdEvaluator<Scalar>::
+bhp(const std::vector<Scalar>& flos,
+    const Scalar wfr,
+    const Scalar gfr)
+{
+    std::vector<Scalar> bhps(flos.size());
+    for (std::size_t i = 0; i < flos.size(); ++i) {
+        bhps[i] = interpolate(-flos[i], wfr, gfr).value;
+    }
+    return bhps;
+}
+
+template<class Scalar>
+detail::VFPEvaluation<Scalar> VFPProdEvaluator<Scalar>::
+interpolate(const Scalar flo,
+            const Scalar wfr,
+            const Scalar gfr)
+{
+    const auto flo_i = VFPHelpers<Scalar>::findInterpData(flo, table_.getFloAxis(), flo_hint_);
+    const auto wfr_i = VFPHelpers<Scalar>::findInterpData(wfr, table_.getWFRAxis(), wfr_hint_);
+    const auto gfr_i = VFPHelpers<Scalar>::findInterpData(gfr, table_.getGFRAxis(), gfr_hint_);
+
+    if (cube_ != std::array<int, 3>{flo_i.ind_[0], wfr_i.ind_[0], gfr_i.ind_[0]}) {
+        updateCorners(flo_i, wfr_i, gfr_i);
+    }
+
+    //Values and derivatives in a 3D hypercube
+    detail::VFPEvaluation<Scalar> nn[2][2][2];
+    for (int f=0; f<=1; ++f) {
+        for (int w=0; w<=1; ++w) {
+            for (int g=0; g<=1; ++g) {
+                nn[f][w][g] = corners_[f][w][g];
+            }
+        }
+    }
+
+    //Calculate derivatives, see VFPHelpers::interpolate()
+    for (int i=0; i<=1; ++i) {
+        for (int j=0; j<=1; ++j) {
+            nn[0][i][j].dflo = (nn[1][i][j].value - nn[0][i][j].value) * flo_i.inv_dist_;
+            nn[i][0][j].dwfr = (nn[i][1][j].value - nn[i][0][j].value) * wfr_i.inv_dist_;
+            nn[i][j][0].dgfr = (nn[i][j][1].value - nn[i][j][0].value) * gfr_i.inv_dist_;
+
+            nn[1][i][j].dflo = nn[0][i][j].dflo;
+            nn[i][1][j].dwfr = nn[i][0][j].dwfr;
+            nn[i][j][1].dgfr = nn[i][j][0].dgfr;
+        }
+    }
+
+    // Remove dimensions one by one, in the same order as VFPHelpers::interpolate()
+    Scalar t2 = flo_i.factor_;
+    Scalar t1 = (1.0-t2);
+    for (int w=0; w<=1; ++w) {
+        for (int g=0; g<=1; ++g) {
+            nn[0][w][g] = t1*nn[0][w][g] + t2*nn[1][w][g];
+        }
+    }
+
+    t2 = gfr_i.factor_;
+    t1 = (1.0-t2);
+    for (int w=0; w<=1; ++w) {
+        nn[0][w][0] = t1*nn[0][w][0] + t2*nn[0][w][1];
+    }
+
+    t2 = wfr_i.factor_;
+    t1 = (1.0-t2);
+    nn[0][0][0] = t1*nn[0][0][0] + t2*nn[0][1][0];
+
+    return nn[0][0][0];
+}
+
+template<class Scalar>
+void VFPProdEvaluator<Scalar>::
+updateCorners(const detail::InterpData<Scalar>& flo_i,
+              const detail::InterpData<Scalar>& wfr_i,
+              const detail::InterpData<Scalar>& gfr_i)
+{
+    const Scalar ta = alq_i_.factor_;
+    const Scalar tt = thp_i_.factor_;
+    for (int f=0; f<=1; ++f) {
+        for (int w=0; w<=1; ++w) {
+            for (int g=0; g<=1; ++g) {
+                const int fi = flo_i.ind_[f];
+                const int wi = wfr_i.ind_[w];
+                const int gi = gfr_i.ind_[g];
+
+                // Interpolate in alq for both thp values, then in thp
+                Scalar value[2];
+                Scalar dalq[2];
+                for (int t=0; t<=1; ++t) {
+                    const int ti = thp_i_.ind_[t];
+                    const Scalar v0 = table_(ti, wi, gi, alq_i_.ind_[0], fi);
+                    const Scalar v1 = table_(ti, wi, gi, alq_i_.ind_[1], fi);
+                    value[t] = (1.0-ta)*v0 + ta*v1;
+                    dalq[t] = (v1 - v0) * alq_i_.inv_dist_;
+                }
+
+                auto& corner = corners_[f][w][g];
+                corner = detail::VFPEvaluation<Scalar>{};
+                corner.value = (1.0-tt)*value[0] + tt*value[1];
+                corner.dthp = (value[1] - value[0]) * thp_i_.inv_dist_;
+                corner.dalq = (1.0-tt)*dalq[0] + tt*dalq[1];
+            }
+        }
+    }
+    cube_ = {flo_i.ind_[0], wfr_i.ind_[0], gfr_i.ind_[0]};
+}
+
 namespace detail {
 
 template<class Scalar>
@@ -838,9 +1004,11 @@ INSTANTIATE_TYPE(float)
 } // namespace detail
 
 template class VFPHelpers<double>;
+template class VFPProdEvaluator<double>;
 
 #if FLOW_INSTANTIATE_FLOAT
 template class VFPHelpers<float>;
+template class VFPProdEvaluator<float>;
 #endif
 
 } // namespace Opm
@@ -21,6 +21,7 @@
 #ifndef OPM_AUTODIFF_VFPHELPERS_HPP_
 #define OPM_AUTODIFF_VFPHELPERS_HPP_
 
+#include <array>
 #include <functional>
 #include <map>
 #include <vector>
@@ -147,6 +148,16 @@ public:
     static detail::InterpData<Scalar> findInterpData(const Scalar value_in,
                                                      const std::vector<double>& values);
 
+    /**
+     * As above, but the search starts at the interval given by hint, which
+     * is updated to the interval found. Consecutive lookups of nearby values
+     * then only check one or two intervals instead of searching the axis.
+     *  @param hint Upper index of the previous interior interval.
+     */
+    static detail::InterpData<Scalar> findInterpData(const Scalar value_in,
+                                                     const std::vector<double>& values,
+                                                     int& hint);
+
     /**
      * Helper function which interpolates data using the indices etc. given in the inputs.
      */
@@ -217,6 +228,76 @@ public:
                      const std::function<Scalar(const Scalar)>& adjust_bhp);
 };
 
+/**
+ * Repeated bhp evaluation of a production table for fixed thp and alq.
+ *
+ * THP limit solves, gas lift optimization and network balancing evaluate
+ * the same table many times at fixed thp and alq while the rates change
+ * gradually. This class keeps the last interval on the flo, wfr and gfr
+ * axes as the starting point for the next search, and the corners of the
+ * last flo/wfr/gfr hypercube with the thp and alq interpolation already
+ * done. Evaluations inside the same hypercube thus only need a trilinear
+ * interpolation of eight cached corners instead of reading 32 table values.
+ * The results equal those of VFPHelpers::bhp() up to round-off.
+ *
+ * The cache is not synchronized, so each thread needs its own evaluator.
+ */
+template<class Scalar>
+class VFPProdEvaluator {
+public:
+    VFPProdEvaluator(const VFPProdTable& table,
+                     const Scalar thp,
+                     const Scalar alq);
+
+    /**
+     * Same as VFPHelpers::bhp() for the thp and alq of this evaluator.
+     */
+    detail::VFPEvaluation<Scalar> bhp(const Scalar aqua,
+                                      const Scalar liquid,
+                                      const Scalar vapour,
+                                      const Scalar explicit_wfr,
+                                      const Scalar explicit_gfr,
+                                      const bool   use_vfpexplicit);
+
+    /**
+     * Batched evaluation for fixed wfr and gfr.
+     *  @param flos Rates, negative for production as in Opm.
+     *  @return Table bhp for each rate.
+     */
+    std::vector<Scalar> bhp(const std::vector<Scalar>& flos,
+                            const Scalar wfr,
+                            const Scalar gfr);
+
+    /**
+     * Interpolate the table at the given flo, wfr and gfr. The flo is
+     * positive for production, as in the table.
+     */
+    detail::VFPEvaluation<Scalar> interpolate(const Scalar flo,
+                                              const Scalar wfr,
+                                              const Scalar gfr);
+
+private:
+    void updateCorners(const detail::InterpData<Scalar>& flo_i,
+                       const detail::InterpData<Scalar>& wfr_i,
+                       const detail::InterpData<Scalar>& gfr_i);
+
+    const VFPProdTable& table_;
+    detail::InterpData<Scalar> thp_i_;
+    detail::InterpData<Scalar> alq_i_;
+
+    // Upper index of the last interval on the flo, wfr and gfr axes
+    int flo_hint_ = 1;
+    int wfr_hint_ = 1;
+    int gfr_hint_ = 1;
+
+    // Lower flo, wfr and gfr indices of the cached hypercube, -1 if none
+    std::array<int, 3> cube_{-1, -1, -1};
+
+    // Corners [flo][wfr][gfr] of the cached hypercube, interpolated in thp
+    // and alq. Only value, dthp and dalq are set.
+    detail::VFPEvaluation<Scalar> corners_[2][2][2];
+};
+
 } // namespace
 
 #endif /* OPM_AUTODIFF_VFPHELPERS_HPP_ */
@@ -120,19 +120,15 @@ bhpwithflo(const std::vector<Scalar>& flos,
 {
     // Get the table
     const VFPProdTable& table = detail::getTable(m_tables, table_id);
-    const auto thp_i = VFPHelpers<Scalar>::findInterpData( thp, table.getTHPAxis()); // assume constant
-    const auto wfr_i = VFPHelpers<Scalar>::findInterpData( wfr, table.getWFRAxis());
-    const auto gfr_i = VFPHelpers<Scalar>::findInterpData( gfr, table.getGFRAxis());
-    const auto alq_i = VFPHelpers<Scalar>::findInterpData( alq, table.getALQAxis()); //assume constant
-
-    std::vector<Scalar> bhps(flos.size(), 0.);
-    for (std::size_t i = 0; i < flos.size(); ++i) {
-        // Value of FLO is negative in OPM for producers, but positive in VFP table
-        const auto flo_i = VFPHelpers<Scalar>::findInterpData(-flos[i], table.getFloAxis());
-        const detail::VFPEvaluation bhp_val = VFPHelpers<Scalar>::interpolate(table, flo_i, thp_i, wfr_i, gfr_i, alq_i);
-
-        // TODO: this kind of breaks the conventions for the functions here by putting dp within the function
-        bhps[i] = bhp_val.value - dp;
+
+    // Value of FLO is negative in OPM for producers, but positive in VFP table.
+    // The evaluator takes care of the sign.
+    VFPProdEvaluator<Scalar> evaluator(table, thp, alq);
+    auto bhps = evaluator.bhp(flos, wfr, gfr);
+
+    // TODO: this kind of breaks the conventions for the functions here by putting dp within the function
+    for (auto& bhp : bhps) {
+        bhp -= dp;
     }
 
     return bhps;
@@ -231,22 +231,22 @@ computeBhpAtThpLimitProd(const std::function<std::vector<Scalar>(const Scalar)>&
                                                                 rho,
                                                                 well_.gravity());
 
-    auto fbhp = [this, &controls, thp_limit, dp, alq_value](const std::vector<Scalar>& rates) {
+    // The solver evaluates the table many times at fixed thp and alq, so the
+    // table brackets and the thp/alq interpolation are cached for this solve.
+    VFPProdEvaluator<Scalar> vfp_evaluator(table, thp_limit, alq_value);
+    auto fbhp = [this, &controls, &vfp_evaluator, thp_limit, dp](const std::vector<Scalar>& rates) {
         assert(rates.size() == 3);
         const auto& wfr =  well_.vfpProperties()->getExplicitWFR(controls.vfp_table_number,
                                                                 well_.indexOfWell());
         const auto& gfr = well_.vfpProperties()->getExplicitGFR(controls.vfp_table_number,
                                                                 well_.indexOfWell());
         const bool use_vfpexp = well_.useVfpExplicit();
-        const Scalar bhp = well_.vfpProperties()->getProd()->bhp(controls.vfp_table_number,
-                                                                 rates[Water],
-                                                                 rates[Oil],
-                                                                 rates[Gas],
-                                                                 thp_limit,
-                                                                 alq_value,
-                                                                 wfr,
-                                                                 gfr,
-                                                                 use_vfpexp);
+        const Scalar bhp = vfp_evaluator.bhp(rates[Water],
+                                             rates[Oil],
+                                             rates[Gas],
+                                             wfr,
+                                             gfr,
+                                             use_vfpexp).value;
         return bhp - dp + getVfpBhpAdjustment(bhp, thp_limit);
     };
 
@@ -102,7 +102,7 @@ public:
     {
         OPM_BEGIN_PARALLEL_TRY_CATCH();
         for (const auto& well : model_) {
-            this->linearizeSingleWell(jacobian, res, well);
+            this->linearizeSingleWell(jacobian, res, well, linearize_res_local_);
         }
         OPM_END_PARALLEL_TRY_CATCH("BlackoilWellModel::linearize failed: ", lin_comm_);
     }
@@ -120,9 +120,12 @@ public:
         // Note: no point in trying to do a parallel gathering
         // try/catch here, as this function is not called in
         // parallel but for each individual domain of each rank.
+        // Domains may be linearized concurrently on different threads,
+        // hence the scratch vector is local here.
+        GlobalEqVector res_local;
         for (const auto& well : model_) {
             if (model_.well_domain().at(well->name()) == domain.index) {
-                this->linearizeSingleWell(jacobian, res, well);
+                this->linearizeSingleWell(jacobian, res, well, res_local);
             }
         }
     }
@@ -152,23 +155,24 @@ private:
     template<class WellType>
     void linearizeSingleWell(SparseMatrixAdapter& jacobian,
                              GlobalEqVector& res,
-                             const WellType& well)
+                             const WellType& well,
+                             GlobalEqVector& res_local)
     {
         if (model_.addMatrixContributions()) {
             well->addWellContributions(jacobian);
         }
 
         const auto& cells = well->cells();
-        linearize_res_local_.resize(cells.size());
+        res_local.resize(cells.size());
 
         for (size_t i = 0; i < cells.size(); ++i) {
-           linearize_res_local_[i] = res[cells[i]];
+           res_local[i] = res[cells[i]];
         }
 
-        well->apply(linearize_res_local_);
+        well->apply(res_local);
 
         for (size_t i = 0; i < cells.size(); ++i) {
-            res[cells[i]] = linearize_res_local_[i];
+            res[cells[i]] = res_local[i];
         }
     }
 
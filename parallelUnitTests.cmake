@@ -168,6 +168,23 @@ opm_add_test(test_broadcast
     4
 )
 
+opm_add_test(test_sumMaxReduction
+  DEPENDS
+    opmsimulators
+  LIBRARIES
+    opmsimulators
+    Boost::unit_test_framework
+  SOURCES
+    tests/test_sumMaxReduction.cpp
+  CONDITION
+    MPI_FOUND AND Boost_UNIT_TEST_FRAMEWORK_FOUND
+  DRIVER_ARGS
+    -n 4
+    -b ${PROJECT_BINARY_DIR}
+  PROCESSORS
+    4
+)
+
 opm_add_test(test_HDF5File_Parallel
   DEPENDS
     opmsimulators
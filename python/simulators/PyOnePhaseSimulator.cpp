@@ -108,6 +108,8 @@ void export_PyOnePhaseSimulator(py::module& m)
         .def("current_step", &PyBaseSimulator<TypeTag>::currentStep, currentStep_docstring)
         .def("get_cell_volumes", &PyBaseSimulator<TypeTag>::getCellVolumes, getCellVolumes_docstring)
         .def("get_dt", &PyBaseSimulator<TypeTag>::getDT, getDT_docstring)
+        .def("get_fields", &PyBaseSimulator<TypeTag>::getFields,
+            getFields_docstring, py::arg("names"))
         .def("get_fluidstate_variable", &PyBaseSimulator<TypeTag>::getFluidStateVariable,
             py::return_value_policy::copy, getFluidStateVariable_docstring, py::arg("name"))
         .def("get_porosity", &PyBaseSimulator<TypeTag>::getPorosity, getPorosity_docstring)
@@ -117,6 +119,8 @@ void export_PyOnePhaseSimulator(py::module& m)
             py::return_value_policy::copy, getPrimaryVarMeaningMap_docstring, py::arg("variable"))
         .def("get_primary_variable", &PyBaseSimulator<TypeTag>::getPrimaryVariable,
             py::return_value_policy::copy, getPrimaryVariable_docstring, py::arg("variable"))
+        .def("get_primary_variable_view", &PyBaseSimulator<TypeTag>::getPrimaryVariableView,
+            py::keep_alive<0, 1>(), getPrimaryVariableView_docstring, py::arg("variable"))
         .def("run", &PyBaseSimulator<TypeTag>::run, run_docstring)
         .def("set_porosity", &PyBaseSimulator<TypeTag>::setPorosity, setPorosity_docstring, py::arg("array"))
         .def("set_primary_variable", &PyBaseSimulator<TypeTag>::setPrimaryVariable,
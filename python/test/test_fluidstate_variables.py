@@ -49,6 +49,13 @@ class TestBasic(unittest.TestCase):
             self.assertAlmostEqual(Sg[0], 0.055138968544, places=3, msg='value of gas saturation')
             T = sim.get_fluidstate_variable(name='T')
             self.assertAlmostEqual(T[0], 288.705, places=3, msg='value of temperature')
+            fields = sim.get_fields(names=['po', 'Sw', 'T', 'pressure'])
+            self.assertEqual(fields.shape, (4, len(oil_pressure)))
+            self.assertAlmostEqual(fields[0][0], oil_pressure[0], places=5, msg='batched oil pressure')
+            self.assertAlmostEqual(fields[1][0], Sw[0], places=10, msg='batched water saturation')
+            self.assertAlmostEqual(fields[2][0], T[0], places=10, msg='batched temperature')
+            pressure = sim.get_primary_variable(variable='pressure')
+            self.assertAlmostEqual(fields[3][0], pressure[0], places=5, msg='batched pressure')
 
     def test_02_onephase(self):
         with pushd(self.data_dir_op):
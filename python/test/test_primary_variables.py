@@ -30,6 +30,13 @@ class TestBasic(unittest.TestCase):
             sim.step()
             pressure = sim.get_primary_variable(variable='pressure')
             self.assertAlmostEqual(pressure[0], 35795160.67, delta=1e4, msg='value of pressure')
+            view = sim.get_primary_variable_view(variable='pressure')
+            self.assertEqual(len(view), len(pressure))
+            self.assertEqual(view[0], pressure[0])
+            self.assertEqual(view[-1], pressure[-1])
+            view[0] = 2.0 * pressure[0]
+            self.assertEqual(sim.get_primary_variable(variable='pressure')[0], 2.0 * pressure[0])
+            view[0] = pressure[0]
             pressure_meaning = sim.get_primary_variable_meaning(
                 variable='pressure')
             pressure_meaning_map = sim.get_primary_variable_meaning_map(
@@ -50,6 +57,10 @@ class TestBasic(unittest.TestCase):
             brine_meaning_map = sim.get_primary_variable_meaning_map(
                 variable='brine')
             self.assertEqual(brine_meaning[0], brine_meaning_map["Disabled"])
+            sim.step_cleanup()
+            self.assertFalse(view.flags.writeable)
+            with self.assertRaises(RuntimeError):
+                sim.get_primary_variable_view(variable='pressure')
 
     def test_02_onephase(self):
         with pushd(self.data_dir_op):
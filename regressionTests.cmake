@@ -36,6 +36,23 @@ add_test_compareECLFiles(
     compositional
 )
 
+add_test_compareECLFiles(
+  CASENAME
+    1dcompositional_tpfa
+  FILENAME
+    1D_COMP
+  SIMULATOR
+    flowexp_comp_tpfa
+  REF_SIMULATOR
+    flowexp_comp
+  ABS_TOL
+    ${abs_tol}
+  REL_TOL
+    ${coarse_rel_tol}
+  DIR
+    compositional
+)
+
 add_test_compareECLFiles(
   CASENAME
     spe12
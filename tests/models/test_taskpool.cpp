@@ -0,0 +1,131 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+#include <config.h>
+
+#define BOOST_TEST_MODULE TaskPoolTests
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/models/parallel/taskpool.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// Recursive fork/join sum of [begin, end), exercises nested groups and stealing.
+long sumRange(Opm::TaskPool& pool, long begin, long end)
+{
+    if (end - begin <= 1000) {
+        long sum = 0;
+        for (long i = begin; i < end; ++i)
+            sum += i;
+        return sum;
+    }
+
+    const long mid = begin + (end - begin) / 2;
+    long left = 0;
+    Opm::TaskPool::TaskGroup group(pool);
+    group.run([&] { left = sumRange(pool, begin, mid); });
+    const long right = sumRange(pool, mid, end);
+    group.wait();
+    return left + right;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(SynchronousMode)
+{
+    Opm::TaskPool pool(0);
+    BOOST_CHECK_EQUAL(pool.numWorkerThreads(), 0);
+    BOOST_CHECK_EQUAL(pool.workerThreadIndex(), -1);
+
+    int count = 0;
+    Opm::TaskPool::TaskGroup group(pool);
+    for (int i = 0; i < 10; ++i)
+        group.run([&count] { ++count; });
+    // tasks are run immediately by the spawning thread
+    BOOST_CHECK_EQUAL(count, 10);
+    group.wait();
+}
+
+BOOST_AUTO_TEST_CASE(ManyTasks)
+{
+    Opm::TaskPool pool(3);
+    BOOST_CHECK_EQUAL(pool.numWorkerThreads(), 3);
+    BOOST_CHECK_EQUAL(pool.workerThreadIndex(), -1);
+
+    constexpr std::size_t numTasks = 10000;
+    std::vector<int> visited(numTasks, 0);
+    std::atomic<bool> validIndex = true;
+    {
+        Opm::TaskPool::TaskGroup group(pool);
+        for (std::size_t i = 0; i < numTasks; ++i) {
+            group.run([&, i] {
+                const int idx = pool.workerThreadIndex();
+                if (idx >= pool.numWorkerThreads())
+                    validIndex = false;
+                ++visited[i];
+            });
+        }
+        group.wait();
+    }
+
+    BOOST_CHECK(validIndex);
+    BOOST_CHECK_EQUAL(std::accumulate(visited.begin(), visited.end(), std::size_t{0}), numTasks);
+}
+
+BOOST_AUTO_TEST_CASE(NestedForkJoin)
+{
+    for (unsigned numWorkers : {0u, 1u, 4u}) {
+        Opm::TaskPool pool(numWorkers);
+        const long n = 1000000;
+        BOOST_CHECK_EQUAL(sumRange(pool, 0, n), n * (n - 1) / 2);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ExceptionIsRethrown)
+{
+    Opm::TaskPool pool(2);
+    std::atomic<int> count = 0;
+
+    Opm::TaskPool::TaskGroup group(pool);
+    for (int i = 0; i < 100; ++i) {
+        group.run([&count, i] {
+            ++count;
+            if (i == 42)
+                throw std::runtime_error("Intentional failure for testing");
+        });
+    }
+    BOOST_CHECK_THROW(group.wait(), std::runtime_error);
+    // all other tasks have still been run
+    BOOST_CHECK_EQUAL(count.load(), 100);
+
+    // the group can be reused after the exception has been reported
+    group.run([&count] { ++count; });
+    BOOST_CHECK_NO_THROW(group.wait());
+    BOOST_CHECK_EQUAL(count.load(), 101);
+}
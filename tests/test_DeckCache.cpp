@@ -0,0 +1,211 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <config.h>
+
+#define BOOST_TEST_MODULE TestDeckCache
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
+#include <opm/input/eclipse/Parser/ErrorGuard.hpp>
+#include <opm/input/eclipse/Parser/ParseContext.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Schedule/Action/State.hpp>
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTestState.hpp>
+
+#include <opm/simulators/utils/DeckCache.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+void writeFile(const std::filesystem::path& file, const std::string& content)
+{
+    std::ofstream os(file);
+    os << content;
+}
+
+// A minimal deck with the TITLE in an included file.
+const std::string mainDeck = R"(
+RUNSPEC
+INCLUDE
+  'TITLE.INC' /
+DIMENS
+  2 2 1 /
+OIL
+WATER
+METRIC
+START
+  1 'JAN' 2020 /
+GRID
+DX
+  4*100 /
+DY
+  4*100 /
+DZ
+  4*10 /
+TOPS
+  4*1000 /
+PORO
+  4*0.2 /
+PERMX
+  4*100 /
+PERMY
+  4*100 /
+PERMZ
+  4*10 /
+SCHEDULE
+TSTEP
+  1 /
+)";
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(RoundTrip)
+{
+    const std::string deckFile = "GCONSUMP.DATA";
+    const auto cacheFile = std::filesystem::temp_directory_path() / "test_deckcache.bin";
+    std::filesystem::remove(cacheFile);
+
+    const auto deck = Opm::Parser{}.parseFile(deckFile);
+    const auto fingerprint = Opm::DeckCache::makeFingerprint(deck, {"normal", "100"});
+    Opm::EclipseState eclState(deck);
+    Opm::ParseContext parseContext;
+    Opm::ErrorGuard errors;
+    Opm::Schedule schedule(deck, eclState);
+    Opm::SummaryConfig summaryConfig(deck, schedule, eclState.fieldProps(),
+                                     eclState.aquifer(), parseContext, errors);
+    Opm::UDQState udqState(0);
+    Opm::Action::State actionState;
+    Opm::WellTestState wtestState;
+
+    Opm::DeckCache writer(cacheFile.string(), fingerprint);
+    BOOST_CHECK(!writer.valid());
+    writer.write(eclState, schedule, summaryConfig, udqState, actionState, wtestState);
+    BOOST_CHECK(writer.valid());
+
+    // A different fingerprint invalidates the cache.
+    const Opm::DeckCache other(cacheFile.string(),
+                               Opm::DeckCache::makeFingerprint(deck, {"high", "100"}));
+    BOOST_CHECK(!other.valid());
+
+    Opm::Schedule schedule2;
+    Opm::SummaryConfig summaryConfig2;
+    Opm::UDQState udqState2(0);
+    Opm::Action::State actionState2;
+    Opm::WellTestState wtestState2;
+    Opm::DeckCache reader(cacheFile.string(), fingerprint);
+    reader.readDynamicState(schedule2, summaryConfig2, udqState2, actionState2, wtestState2);
+    BOOST_CHECK(schedule2 == schedule);
+    BOOST_CHECK(summaryConfig2 == summaryConfig);
+
+    // A truncated cache is rejected.
+    std::filesystem::resize_file(cacheFile, std::filesystem::file_size(cacheFile) - 1);
+    BOOST_CHECK(!reader.valid());
+
+    std::filesystem::remove(cacheFile);
+}
+
+BOOST_AUTO_TEST_CASE(ChangedInclude)
+{
+    const auto dir = std::filesystem::temp_directory_path() / "test_deckcache_include";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    const auto deckFile = dir / "CASE.DATA";
+    const auto includeFile = dir / "TITLE.INC";
+    const auto cacheFile = dir / "CASE.CACHE";
+    writeFile(deckFile, mainDeck);
+    writeFile(includeFile, "TITLE\n  First title\n");
+
+    const auto write = [&cacheFile](const Opm::Deck& deck)
+    {
+        Opm::EclipseState eclState(deck);
+        Opm::ParseContext parseContext;
+        Opm::ErrorGuard errors;
+        Opm::Schedule schedule(deck, eclState);
+        Opm::SummaryConfig summaryConfig(deck, schedule, eclState.fieldProps(),
+                                         eclState.aquifer(), parseContext, errors);
+        Opm::UDQState udqState(0);
+        Opm::Action::State actionState;
+        Opm::WellTestState wtestState;
+        Opm::DeckCache cache(cacheFile.string(), Opm::DeckCache::makeFingerprint(deck, {}));
+        cache.write(eclState, schedule, summaryConfig, udqState, actionState, wtestState);
+    };
+
+    const auto deck1 = Opm::Parser{}.parseFile(deckFile.string());
+    const auto fingerprint1 = Opm::DeckCache::makeFingerprint(deck1, {});
+    write(deck1);
+    {
+        Opm::DeckCache reader(cacheFile.string(), fingerprint1);
+        BOOST_REQUIRE(reader.valid());
+        Opm::EclipseState eclState;
+        reader.readEclipseState(eclState);
+        BOOST_CHECK_EQUAL(eclState.getTitle(), "First title");
+    }
+
+    // Only the included file changes.
+    writeFile(includeFile, "TITLE\n  Second longer title\n");
+    const auto deck2 = Opm::Parser{}.parseFile(deckFile.string());
+    const auto fingerprint2 = Opm::DeckCache::makeFingerprint(deck2, {});
+    BOOST_CHECK(fingerprint2 != fingerprint1);
+    {
+        Opm::DeckCache reader(cacheFile.string(), fingerprint2);
+        BOOST_CHECK(!reader.valid());
+        Opm::EclipseState eclState;
+        BOOST_CHECK_THROW(reader.readEclipseState(eclState), std::runtime_error);
+    }
+
+    write(deck2);
+    {
+        Opm::DeckCache reader(cacheFile.string(), fingerprint2);
+        BOOST_REQUIRE(reader.valid());
+        Opm::EclipseState eclState;
+        reader.readEclipseState(eclState);
+        BOOST_CHECK_EQUAL(eclState.getTitle(), "Second longer title");
+    }
+
+    std::filesystem::remove_all(dir);
+}
+
+BOOST_AUTO_TEST_CASE(CorruptHeader)
+{
+    const auto cacheFile = std::filesystem::temp_directory_path() / "test_deckcache_corrupt.bin";
+    {
+        // Valid magic followed by a huge fingerprint size.
+        std::ofstream os(cacheFile, std::ios::binary);
+        os.write("OPMDCK01", 8);
+        const std::uint64_t fingerprintSize = std::uint64_t{1} << 60;
+        os.write(reinterpret_cast<const char*>(&fingerprintSize), sizeof(fingerprintSize));
+    }
+
+    Opm::DeckCache reader(cacheFile.string(), std::string{});
+    BOOST_CHECK(!reader.valid());
+    Opm::EclipseState eclState;
+    BOOST_CHECK_THROW(reader.readEclipseState(eclState), std::runtime_error);
+
+    std::filesystem::remove(cacheFile);
+}
@@ -0,0 +1,164 @@
+/*
+  Copyright 2025 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE GroupTopologyTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Schedule/Group/Group.hpp>
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+
+#include <opm/simulators/wells/GroupTopology.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace Opm;
+
+namespace {
+
+// Group hierarchy of GCONSUMP.DATA:
+//   FIELD
+//   └── PLAT-A
+//       └── SUB-B
+//           └── WELL-C
+Schedule makeSchedule()
+{
+    Parser parser;
+    const auto deck = parser.parseFile("GCONSUMP.DATA");
+    const EclipseState eclipseState{deck};
+    return Schedule{deck, eclipseState};
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(EmptyTopology)
+{
+    const GroupTopology topology;
+    BOOST_CHECK(!topology.reportStep().has_value());
+    BOOST_CHECK_EQUAL(topology.numGroups(), 0);
+    BOOST_CHECK_EQUAL(topology.groupIndex("FIELD"), GroupTopology::InvalidIndex);
+    BOOST_CHECK(!topology.chainTopBot("WELL-C", "FIELD").has_value());
+    BOOST_CHECK(!topology.isInChainTopBot("WELL-C", "FIELD").has_value());
+}
+
+BOOST_AUTO_TEST_CASE(ParentsAndAncestors)
+{
+    const auto schedule = makeSchedule();
+    const GroupTopology topology{schedule, 0};
+
+    BOOST_CHECK_EQUAL(topology.reportStep().value(), 0u);
+    BOOST_CHECK_EQUAL(topology.numGroups(), 3);
+    BOOST_CHECK_EQUAL(topology.numWells(), 1);
+
+    const int field = topology.groupIndex("FIELD");
+    const int plat = topology.groupIndex("PLAT-A");
+    const int sub = topology.groupIndex("SUB-B");
+    const int well = topology.wellIndex("WELL-C");
+    BOOST_REQUIRE(field != GroupTopology::InvalidIndex);
+    BOOST_REQUIRE(plat != GroupTopology::InvalidIndex);
+    BOOST_REQUIRE(sub != GroupTopology::InvalidIndex);
+    BOOST_REQUIRE(well != GroupTopology::InvalidIndex);
+    BOOST_CHECK_EQUAL(topology.wellIndex("SUB-B"), GroupTopology::InvalidIndex);
+
+    BOOST_CHECK_EQUAL(topology.groupName(sub), "SUB-B");
+    BOOST_CHECK_EQUAL(topology.wellName(well), "WELL-C");
+
+    BOOST_CHECK_EQUAL(topology.groupParent(field), GroupTopology::InvalidIndex);
+    BOOST_CHECK_EQUAL(topology.groupParent(plat), field);
+    BOOST_CHECK_EQUAL(topology.groupParent(sub), plat);
+    BOOST_CHECK_EQUAL(topology.wellGroup(well), sub);
+
+    const auto ancestors = topology.groupAncestors(sub);
+    const std::vector<int> expected{sub, plat, field};
+    BOOST_CHECK_EQUAL_COLLECTIONS(ancestors.begin(), ancestors.end(),
+                                  expected.begin(), expected.end());
+    BOOST_CHECK_EQUAL(topology.groupAncestors(field).size(), 1u);
+
+    for (const int group : {field, plat, sub}) {
+        BOOST_CHECK_EQUAL(topology.groupEfficiencyFactor(group),
+                          schedule.getGroup(topology.groupName(group), 0).getGroupEfficiencyFactor());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ChainTopBot)
+{
+    const auto schedule = makeSchedule();
+    const GroupTopology topology{schedule, 0};
+
+    {
+        const auto chain = topology.chainTopBot("WELL-C", "FIELD");
+        BOOST_REQUIRE(chain.has_value());
+        const std::vector<std::string> expected{"FIELD", "PLAT-A", "SUB-B", "WELL-C"};
+        const auto names = chain->names();
+        BOOST_CHECK_EQUAL_COLLECTIONS(names.begin(), names.end(),
+                                      expected.begin(), expected.end());
+        BOOST_CHECK_EQUAL(chain->groupIndex(0), topology.groupIndex("FIELD"));
+        BOOST_CHECK_EQUAL(chain->groupIndex(2), topology.groupIndex("SUB-B"));
+        BOOST_CHECK_EQUAL(chain->groupIndex(3), GroupTopology::InvalidIndex);
+    }
+    {
+        const auto chain = topology.chainTopBot("WELL-C", "SUB-B");
+        BOOST_REQUIRE(chain.has_value());
+        const std::vector<std::string> expected{"SUB-B", "WELL-C"};
+        const auto names = chain->names();
+        BOOST_CHECK_EQUAL_COLLECTIONS(names.begin(), names.end(),
+                                      expected.begin(), expected.end());
+    }
+    {
+        const auto chain = topology.chainTopBot("SUB-B", "FIELD");
+        BOOST_REQUIRE(chain.has_value());
+        const std::vector<std::string> expected{"FIELD", "PLAT-A", "SUB-B"};
+        const auto names = chain->names();
+        BOOST_CHECK_EQUAL_COLLECTIONS(names.begin(), names.end(),
+                                      expected.begin(), expected.end());
+    }
+
+    {
+        // Chains not taken from the topology own their names.
+        const GroupChain chain{{"FIELD", "PLAT-A"}};
+        BOOST_CHECK_EQUAL(chain.size(), 2u);
+        BOOST_CHECK_EQUAL(chain[1], "PLAT-A");
+        BOOST_CHECK_EQUAL(chain.groupIndex(0), GroupTopology::InvalidIndex);
+    }
+
+    // top is not above bottom, or unknown names
+    BOOST_CHECK(!topology.chainTopBot("PLAT-A", "SUB-B").has_value());
+    BOOST_CHECK(!topology.chainTopBot("NO-SUCH-WELL", "FIELD").has_value());
+    BOOST_CHECK(!topology.chainTopBot("WELL-C", "NO-SUCH-GROUP").has_value());
+}
+
+BOOST_AUTO_TEST_CASE(IsInChainTopBot)
+{
+    const auto schedule = makeSchedule();
+    const GroupTopology topology{schedule, 0};
+
+    BOOST_CHECK(topology.isInChainTopBot("WELL-C", "SUB-B").value());
+    BOOST_CHECK(topology.isInChainTopBot("WELL-C", "PLAT-A").value());
+    BOOST_CHECK(topology.isInChainTopBot("WELL-C", "FIELD").value());
+    BOOST_CHECK(topology.isInChainTopBot("SUB-B", "FIELD").value());
+    BOOST_CHECK(!topology.isInChainTopBot("SUB-B", "SUB-B").value());
+    BOOST_CHECK(!topology.isInChainTopBot("PLAT-A", "SUB-B").value());
+    BOOST_CHECK(!topology.isInChainTopBot("FIELD", "FIELD").value());
+    BOOST_CHECK(!topology.isInChainTopBot("NO-SUCH-WELL", "FIELD").has_value());
+}
@@ -0,0 +1,139 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <config.h>
+
+#define BOOST_TEST_MODULE TestMultisegmentWellTreeSolver
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/wells/MultisegmentWellTreeSolver.hpp>
+
+#include <vector>
+
+namespace {
+
+using Solver = Opm::MultisegmentWellTreeSolver<double,3>;
+
+// Main branch 0-1-2-3 with a lateral 4-5 attached to segment 1 and a
+// lateral 6 attached to segment 2.
+const std::vector<int> outlets {-1, 0, 1, 2, 1, 4, 2};
+
+Solver::Matrix makeSegmentMatrix()
+{
+    const int n = outlets.size();
+    std::vector<std::vector<int>> inlets(n);
+    for (int seg = 1; seg < n; ++seg) {
+        inlets[outlets[seg]].push_back(seg);
+    }
+
+    Solver::Matrix D(n, n, Solver::Matrix::row_wise);
+    for (auto row = D.createbegin(); row != D.createend(); ++row) {
+        const int seg = row.index();
+        if (outlets[seg] >= 0) {
+            row.insert(outlets[seg]);
+        }
+        row.insert(seg);
+        for (const int inlet : inlets[seg]) {
+            row.insert(inlet);
+        }
+    }
+
+    // Unsymmetric entries, diagonally dominant.
+    for (auto row = D.begin(); row != D.end(); ++row) {
+        for (auto col = row->begin(); col != row->end(); ++col) {
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    (*col)[i][j] = 0.1 * (1 + i + 2 * j + row.index()) - 0.05 * col.index();
+                }
+            }
+            if (col.index() == row.index()) {
+                for (int i = 0; i < 3; ++i) {
+                    (*col)[i][i] += 10.0 + i;
+                }
+            }
+        }
+    }
+    return D;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(SolveTree)
+{
+    const auto D = makeSegmentMatrix();
+    Solver solver;
+    BOOST_REQUIRE(solver.init(outlets));
+    BOOST_CHECK(!solver.isFactorized());
+    BOOST_REQUIRE(solver.factorize(D));
+    BOOST_CHECK(solver.isFactorized());
+
+    Solver::Vector rhs(D.N());
+    for (std::size_t seg = 0; seg < rhs.size(); ++seg) {
+        for (int i = 0; i < 3; ++i) {
+            rhs[seg][i] = 1.0 + seg - 0.5 * i;
+        }
+    }
+
+    const auto x = solver.solve(rhs);
+    Solver::Vector Dx(D.N());
+    D.mv(x, Dx);
+    for (std::size_t seg = 0; seg < rhs.size(); ++seg) {
+        for (int i = 0; i < 3; ++i) {
+            BOOST_CHECK_CLOSE(Dx[seg][i], rhs[seg][i], 1e-10);
+        }
+    }
+
+    // D * D^-1 = I
+    const auto inv = solver.inverse();
+    for (std::size_t r = 0; r < D.N(); ++r) {
+        for (std::size_t c = 0; c < D.N(); ++c) {
+            Solver::BlockType product(0.0);
+            for (auto col = D[r].begin(); col != D[r].end(); ++col) {
+                auto tmp = *col;
+                tmp.rightmultiply(inv[col.index()][c]);
+                product += tmp;
+            }
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    BOOST_CHECK_SMALL(product[i][j] - (r == c && i == j ? 1.0 : 0.0), 1e-12);
+                }
+            }
+        }
+    }
+
+    solver.reset();
+    BOOST_CHECK(!solver.isFactorized());
+}
+
+BOOST_AUTO_TEST_CASE(RejectCycle)
+{
+    Solver solver;
+    BOOST_CHECK(!solver.init({-1, 2, 1}));
+    BOOST_CHECK(!solver.factorize(makeSegmentMatrix()));
+}
+
+BOOST_AUTO_TEST_CASE(SingularPivot)
+{
+    auto D = makeSegmentMatrix();
+    D[5][5] = 0.0;
+    Solver solver;
+    BOOST_REQUIRE(solver.init(outlets));
+    BOOST_CHECK(!solver.factorize(D));
+    BOOST_CHECK(!solver.isFactorized());
+}
@@ -0,0 +1,123 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <config.h>
+
+#define BOOST_TEST_MODULE TestTimeBlockProfiler
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/utils/TimeBlockProfiler.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace {
+
+#if HAVE_TIMEBLOCK_PROFILER
+// The timing macros are routed to the profiler by the build system, see
+// TimeBlockProfilerMacros.hpp.
+void timedFunction()
+{
+    OPM_TIMEFUNCTION();
+    OPM_TIMEBLOCK(innerBlock);
+}
+
+const Opm::TimeBlockProfiler::Record*
+findRecord(const std::vector<Opm::TimeBlockProfiler::Record>& records,
+           const std::string& name)
+{
+    const auto it = std::find_if(records.begin(), records.end(),
+                                 [&name](const auto& rec) { return rec.name == name; });
+    return it == records.end() ? nullptr : &*it;
+}
+#endif // HAVE_TIMEBLOCK_PROFILER
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(RegisterBlock)
+{
+    const auto id = Opm::TimeBlockProfiler::registerBlock("someBlock", "Subsystem::Assembly");
+    BOOST_CHECK_EQUAL(Opm::TimeBlockProfiler::registerBlock("someBlock", "Assembly"), id);
+    BOOST_CHECK_NE(Opm::TimeBlockProfiler::registerBlock("someBlock", ""), id);
+    BOOST_CHECK_EQUAL(Opm::TimeBlockProfiler::registerBlock("otherBlock",
+                                                            "Subsystem::PvtProps | Subsystem::SatProps"),
+                      Opm::TimeBlockProfiler::registerBlock("otherBlock", "PvtProps|SatProps"));
+}
+
+#if HAVE_TIMEBLOCK_PROFILER
+BOOST_AUTO_TEST_CASE(CountsAllThreads)
+{
+    Opm::TimeBlockProfiler::reset();
+
+    // Not counted while disabled.
+    Opm::TimeBlockProfiler::enable(false);
+    timedFunction();
+    BOOST_CHECK(Opm::TimeBlockProfiler::localRecords().empty());
+
+    Opm::TimeBlockProfiler::enable(true);
+    timedFunction();
+    timedFunction();
+    std::thread worker([] { timedFunction(); });
+    worker.join();
+    Opm::TimeBlockProfiler::enable(false);
+
+    const auto records = Opm::TimeBlockProfiler::localRecords();
+    BOOST_REQUIRE_EQUAL(records.size(), 2u);
+
+    const auto* func = findRecord(records, "timedFunction");
+    BOOST_REQUIRE(func);
+    BOOST_CHECK_EQUAL(func->count, 3u);
+    BOOST_CHECK_EQUAL(func->subsystem, "");
+
+    const auto* inner = findRecord(records, "innerBlock");
+    BOOST_REQUIRE(inner);
+    BOOST_CHECK_EQUAL(inner->count, 3u);
+    BOOST_CHECK_LE(inner->totalTime, func->totalTime);
+
+    Opm::TimeBlockProfiler::reset();
+    BOOST_CHECK(Opm::TimeBlockProfiler::localRecords().empty());
+}
+#endif // HAVE_TIMEBLOCK_PROFILER
+
+BOOST_AUTO_TEST_CASE(WriteCsvAndJson)
+{
+    const std::vector<Opm::TimeBlockProfiler::Record> records {
+        {"assemble", "Assembly", 4, 2.0, 1.5},
+        {"solve", "", 2, 1.0, 0.5},
+    };
+
+    std::ostringstream csv;
+    Opm::TimeBlockProfiler::writeCsv(csv, records);
+    BOOST_CHECK_EQUAL(csv.str(),
+                      "name,subsystem,count,total_time,max_rank_time\n"
+                      "assemble,Assembly,4,2.000000e+00,1.500000e+00\n"
+                      "solve,,2,1.000000e+00,5.000000e-01\n");
+
+    std::ostringstream json;
+    Opm::TimeBlockProfiler::writeJson(json, records);
+    BOOST_CHECK_EQUAL(json.str(),
+                      "[\n"
+                      "  {\"name\": \"assemble\", \"subsystem\": \"Assembly\", \"count\": 4, "
+                      "\"total_time\": 2.000000e+00, \"max_rank_time\": 1.500000e+00},\n"
+                      "  {\"name\": \"solve\", \"subsystem\": \"\", \"count\": 2, "
+                      "\"total_time\": 1.000000e+00, \"max_rank_time\": 5.000000e-01}\n"
+                      "]\n");
+}
@@ -0,0 +1,187 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE TransmissibilityCompactTest
+#define BOOST_TEST_NO_MAIN
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+
+#include <dune/grid/common/mcmgmapper.hh>
+
+#include <opm/grid/CpGrid.hpp>
+
+#include <opm/simulators/flow/Transmissibility.hpp>
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace Opm;
+
+namespace {
+
+constexpr int dimWorld = 3;
+
+bool
+init_unit_test_func()
+{
+    return true;
+}
+
+// Gives access to the hash map of the transmissibilities.
+template<class Grid, class GridView, class ElementMapper, class CartesianIndexMapper, class Scalar>
+class TestTransmissibility : public Transmissibility<Grid,GridView,ElementMapper,CartesianIndexMapper,Scalar>
+{
+    using ParentType = Transmissibility<Grid,GridView,ElementMapper,CartesianIndexMapper,Scalar>;
+public:
+    using ParentType::ParentType;
+
+    const std::unordered_map<std::uint64_t, Scalar>& transMap() const
+    { return this->trans_; }
+};
+
+// 4x3x2 grid with one NNC, so that not all pairs are Cartesian neighbours.
+const char* deckString = R"(RUNSPEC
+DIMENS
+ 4 3 2 /
+GRID
+DX
+  24*10. /
+DY
+  24*20. /
+DZ
+  24*1. /
+TOPS
+  12*100. /
+PORO
+  24*0.25 /
+PERMX
+  24*1000. /
+PERMY
+  24*500. /
+PERMZ
+  24*10. /
+NNC
+-- I1 J1 K1  I2 J2 K2 Trans
+    1  1  1   4  3  2  50.0 /
+/
+END
+)";
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(RoundTrip)
+{
+    using Grid = Dune::CpGrid;
+    using GridView = Grid::LeafGridView;
+    using ElementMapper = Dune::MultipleCodimMultipleGeomTypeMapper<GridView>;
+    using CartesianIndexMapper = Dune::CartesianIndexMapper<Grid>;
+    using Transmissibility = TestTransmissibility<Grid,GridView,ElementMapper,CartesianIndexMapper,double>;
+
+    const auto deck = Parser{}.parseString(deckString);
+    EclipseState eclState(deck);
+    Grid grid;
+    grid.processEclipseFormat(&eclState.getInputGrid(), &eclState, false, false, false);
+    const auto& gridView = grid.leafGridView();
+    const CartesianIndexMapper cartMapper(grid);
+    const auto centroids = [](int) { return std::array<double,dimWorld>{}; };
+
+    Transmissibility reference(eclState, gridView, cartMapper, grid, centroids,
+                               /*enableEnergy=*/true, false, false);
+    reference.update(true);
+
+    Transmissibility compact(eclState, gridView, cartMapper, grid, centroids,
+                             /*enableEnergy=*/true, false, false);
+    compact.setCompactStorage(true);
+    compact.update(true);
+
+    BOOST_REQUIRE(!reference.transMap().empty());
+    BOOST_CHECK(compact.transMap().empty());
+    BOOST_CHECK_EQUAL(reference.compactIndex(0, 1), -1);
+    const auto version = compact.compactLayoutVersion();
+    BOOST_CHECK(version != 0);
+
+    // Pairs not sharing a face, such as the NNC, have no thermal half transmissibility.
+    const auto checkThermal = [&reference](const Transmissibility& trans,
+                                           const unsigned elemIdx1, const unsigned elemIdx2)
+    {
+        double expected = 0.0;
+        try {
+            expected = reference.thermalHalfTrans(elemIdx1, elemIdx2);
+        }
+        catch (const std::out_of_range&) {
+            BOOST_CHECK_THROW(trans.thermalHalfTrans(elemIdx1, elemIdx2), std::out_of_range);
+            return;
+        }
+        BOOST_CHECK_EQUAL(trans.thermalHalfTrans(elemIdx1, elemIdx2), expected);
+    };
+
+    const auto check = [&reference, &checkThermal](const Transmissibility& trans)
+    {
+        for (const auto& [id, value] : reference.transMap()) {
+            const auto [elemIdx1, elemIdx2] = details::isIdReverse(id);
+            BOOST_CHECK_EQUAL(trans.transmissibility(elemIdx1, elemIdx2), value);
+            BOOST_CHECK_EQUAL(trans.transmissibility(elemIdx2, elemIdx1), value);
+
+            const auto idx = trans.compactIndex(elemIdx1, elemIdx2);
+            BOOST_REQUIRE(idx >= 0);
+            BOOST_CHECK_EQUAL(trans.transmissibilityAt(idx), value);
+            BOOST_CHECK_EQUAL(trans.transmissibilityAt(trans.compactIndex(elemIdx2, elemIdx1)), value);
+
+            checkThermal(trans, elemIdx1, elemIdx2);
+            checkThermal(trans, elemIdx2, elemIdx1);
+        }
+    };
+    check(compact);
+
+    // Pairs without a transmissibility are rejected by both storages.
+    const unsigned last = gridView.size(0) - 1;
+    BOOST_CHECK_THROW(reference.transmissibility(1, last), std::out_of_range);
+    BOOST_CHECK_THROW(compact.transmissibility(1, last), std::out_of_range);
+    BOOST_CHECK_EQUAL(compact.compactIndex(1, last), -1);
+    BOOST_CHECK_THROW(compact.transmissibilityAt(-1), std::out_of_range);
+
+    // Recomputing goes through the hash maps and back, keeping the positions.
+    compact.update(true);
+    check(compact);
+    BOOST_CHECK_EQUAL(compact.compactLayoutVersion(), version);
+
+    // Returning to the hash maps invalidates the positions.
+    compact.setCompactStorage(false);
+    BOOST_CHECK(compact.compactLayoutVersion() != version);
+    BOOST_CHECK_EQUAL(compact.compactIndex(0, 1), -1);
+    BOOST_CHECK_EQUAL(compact.transMap().size(), reference.transMap().size());
+    for (const auto& [id, value] : reference.transMap()) {
+        const auto [elemIdx1, elemIdx2] = details::isIdReverse(id);
+        BOOST_CHECK_EQUAL(compact.transmissibility(elemIdx1, elemIdx2), value);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Dune::MPIHelper::instance(argc, argv);
+    return boost::unit_test::unit_test_main(&init_unit_test_func, argc, argv);
+}
@@ -30,6 +30,8 @@
 #include <dune/common/parallel/mpihelper.hh>
 
 #include <numeric>
+#include <string>
+#include <vector>
 
 #if HAVE_MPI
 struct MPIError
@@ -82,6 +84,27 @@ BOOST_AUTO_TEST_CASE(BroadCast)
     BOOST_CHECK_EQUAL(i1, 8);
 }
 
+BOOST_AUTO_TEST_CASE(BroadCastChunked)
+{
+    const auto& cc = Dune::MPIHelper::getCommunication();
+
+    // many more chunks than non-blocking broadcasts in flight
+    std::vector<double> d(10000);
+    std::string s;
+    if (cc.rank() == 0) {
+        std::iota(d.begin(), d.end(), 1.0);
+        s.assign(2500, 'x');
+    }
+
+    Opm::Parallel::MpiSerializer ser(cc, 1000);
+    ser.broadcast(Opm::Parallel::RootRank{0}, d, s);
+
+    for (std::size_t c = 0; c < d.size(); ++c) {
+        BOOST_CHECK_EQUAL(d[c], 1.0 + c);
+    }
+    BOOST_CHECK_EQUAL(s, std::string(2500, 'x'));
+}
+
 int main(int argc, char** argv)
 {
     Dune::MPIHelper::instance(argc, argv);
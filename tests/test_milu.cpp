@@ -199,3 +199,54 @@ BOOST_AUTO_TEST_CASE(MILULaplace4)
 {
     test<4>();
 }
+
+template<int bsize>
+void testLevelScheduling(Opm::MILU_VARIANT milu)
+{
+    using Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<double, bsize, bsize>>;
+    using Vector = Dune::BlockVector<Dune::FieldVector<double, bsize>>;
+    using ILU = Opm::ParallelOverlappingILU0<Matrix, Vector, Vector, Dune::Amg::SequentialInformation>;
+
+    std::size_t N = 32;
+    Matrix A;
+    setupLaplacian(A, N);
+
+    ILU natural(A, 0, 1.0, milu);
+    ILU levelScheduled(A, 0, 1.0, milu, false, true, true);
+
+    Vector d(A.N()), x1(A.N()), x2(A.N());
+    for (std::size_t i = 0; i < d.size(); ++i) {
+        d[i] = 1.0 + static_cast<double>(i % 7);
+    }
+    natural.apply(x1, d);
+    levelScheduled.apply(x2, d);
+    for (std::size_t i = 0; i < d.size(); ++i) {
+        for (int j = 0; j < bsize; ++j) {
+            BOOST_CHECK_CLOSE(x1[i][j], x2[i][j], 1e-10);
+        }
+    }
+
+    // Updating reuses the reordered matrix.
+    A *= 2.0;
+    natural.update();
+    levelScheduled.update();
+    natural.apply(x1, d);
+    levelScheduled.apply(x2, d);
+    for (std::size_t i = 0; i < d.size(); ++i) {
+        for (int j = 0; j < bsize; ++j) {
+            BOOST_CHECK_CLOSE(x1[i][j], x2[i][j], 1e-10);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(LevelScheduledILU)
+{
+    testLevelScheduling<1>(Opm::MILU_VARIANT::ILU);
+    testLevelScheduling<3>(Opm::MILU_VARIANT::ILU);
+}
+
+BOOST_AUTO_TEST_CASE(LevelScheduledMILU)
+{
+    testLevelScheduling<1>(Opm::MILU_VARIANT::MILU_1);
+    testLevelScheduling<2>(Opm::MILU_VARIANT::MILU_2);
+}
@@ -0,0 +1,74 @@
+/*
+  Copyright 2025 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE TestSumMaxReduction
+#define BOOST_TEST_NO_MAIN
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/utils/sumMaxReduction.hpp>
+#include <dune/common/parallel/mpihelper.hh>
+
+#include <limits>
+#include <vector>
+
+bool
+init_unit_test_func()
+{
+    return true;
+}
+
+BOOST_AUTO_TEST_CASE(SumAndMax)
+{
+    const auto& cc = Dune::MPIHelper::getCommunication();
+    const int size = cc.size();
+    const double rank = cc.rank();
+
+    std::vector<double> sums{rank, 1.0, -2.0};
+    std::vector<double> maxes{rank, -rank, std::numeric_limits<double>::lowest()};
+
+    Opm::sumMaxReduction(cc, sums, maxes);
+
+    BOOST_CHECK_EQUAL(sums[0], size * (size - 1) / 2.0);
+    BOOST_CHECK_EQUAL(sums[1], 1.0 * size);
+    BOOST_CHECK_EQUAL(sums[2], -2.0 * size);
+    BOOST_CHECK_EQUAL(maxes[0], size - 1.0);
+    BOOST_CHECK_EQUAL(maxes[1], 0.0);
+    BOOST_CHECK_EQUAL(maxes[2], std::numeric_limits<double>::lowest());
+}
+
+BOOST_AUTO_TEST_CASE(EmptyMax)
+{
+    const auto& cc = Dune::MPIHelper::getCommunication();
+
+    std::vector<double> sums{2.0};
+    std::vector<double> maxes;
+
+    Opm::sumMaxReduction(cc, sums, maxes);
+
+    BOOST_CHECK_EQUAL(sums[0], 2.0 * cc.size());
+}
+
+int main(int argc, char** argv)
+{
+    Dune::MPIHelper::instance(argc, argv);
+    return boost::unit_test::unit_test_main(&init_unit_test_func, argc, argv);
+}
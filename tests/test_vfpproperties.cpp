@@ -100,6 +100,25 @@ BOOST_AUTO_TEST_CASE(findInterpData)
     BOOST_CHECK_EQUAL(eval5.factor_, 1.0);
 }
 
+BOOST_AUTO_TEST_CASE(findInterpDataWithHint)
+{
+    std::vector<double> values = {1, 5, 7, 9, 11, 15};
+    const std::vector<double> lookups = {6.0, 7.0, 8.0, 14.0, 0.5, 19.0, 9.0, 5.0, 1.0, 3.0};
+
+    // Any hint, also a stale or invalid one, gives the same result as the plain search
+    for (int start_hint = -1; start_hint <= 7; ++start_hint) {
+        int hint = start_hint;
+        for (const double value : lookups) {
+            const auto eval = Opm::VFPHelpers<double>::findInterpData(value, values);
+            const auto eval_hint = Opm::VFPHelpers<double>::findInterpData(value, values, hint);
+            BOOST_CHECK_EQUAL(eval_hint.ind_[0], eval.ind_[0]);
+            BOOST_CHECK_EQUAL(eval_hint.ind_[1], eval.ind_[1]);
+            BOOST_CHECK_EQUAL(eval_hint.factor_, eval.factor_);
+            BOOST_CHECK_EQUAL(eval_hint.inv_dist_, eval.inv_dist_);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // HelperTests
 
 
@@ -571,6 +590,64 @@ BOOST_AUTO_TEST_CASE(ExplicitBhpLookup)
     BOOST_CHECK_CLOSE(bhp_val, bhp_val_explicit, max_d_tol);
 }
 
+/**
+ * Test that the cached evaluator gives the same values and derivatives as
+ * the full interpolation, also when moving back and forth between hypercubes
+ */
+BOOST_AUTO_TEST_CASE(ProdEvaluator)
+{
+    fillDataRandom();
+    initProperties();
+
+    const double thp = 0.3;
+    const double alq = 0.45;
+    Opm::VFPProdEvaluator<double> evaluator(*table, thp, alq);
+
+    const int n = 20;
+    for (int pass = 0; pass < 2; ++pass) {
+        for (int i = 0; i <= n; ++i) {
+            // Forward and then backward along the flo axis, with some extrapolation
+            const double s = (pass == 0 ? i : n - i) / static_cast<double>(n);
+            const double aqua = -0.3 * s;
+            const double liquid = -1.1 * s + 0.05;
+            const double vapour = -0.4 * s * s;
+
+            const VFPEvaluation ref = Opm::VFPHelpers<double>::bhp(*table, aqua, liquid, vapour,
+                                                                   thp, alq, 0.2, 0.6, false);
+            const VFPEvaluation eval = evaluator.bhp(aqua, liquid, vapour, 0.2, 0.6, false);
+            BOOST_CHECK_CLOSE(eval.value, ref.value, max_d_tol);
+            BOOST_CHECK_CLOSE(eval.dthp, ref.dthp, max_d_tol);
+            BOOST_CHECK_CLOSE(eval.dwfr, ref.dwfr, max_d_tol);
+            BOOST_CHECK_CLOSE(eval.dgfr, ref.dgfr, max_d_tol);
+            BOOST_CHECK_CLOSE(eval.dalq, ref.dalq, max_d_tol);
+            BOOST_CHECK_CLOSE(eval.dflo, ref.dflo, max_d_tol);
+        }
+    }
+
+    // Batched evaluation
+    const double wfr = 0.7;
+    const double gfr = 0.35;
+    std::vector<double> flos(n + 1);
+    for (int i = 0; i <= n; ++i) {
+        flos[i] = -1.2 * i / static_cast<double>(n);
+    }
+    const auto bhps = evaluator.bhp(flos, wfr, gfr);
+    const auto bhps_dp = properties->bhpwithflo(flos, 1, wfr, gfr, thp, alq, 0.1);
+    BOOST_REQUIRE_EQUAL(bhps.size(), flos.size());
+    BOOST_REQUIRE_EQUAL(bhps_dp.size(), flos.size());
+    for (int i = 0; i <= n; ++i) {
+        const auto flo_i = Opm::VFPHelpers<double>::findInterpData(-flos[i], table->getFloAxis());
+        const auto thp_i = Opm::VFPHelpers<double>::findInterpData(thp, table->getTHPAxis());
+        const auto wfr_i = Opm::VFPHelpers<double>::findInterpData(wfr, table->getWFRAxis());
+        const auto gfr_i = Opm::VFPHelpers<double>::findInterpData(gfr, table->getGFRAxis());
+        const auto alq_i = Opm::VFPHelpers<double>::findInterpData(alq, table->getALQAxis());
+        const VFPEvaluation ref = Opm::VFPHelpers<double>::interpolate(*table, flo_i, thp_i,
+                                                                       wfr_i, gfr_i, alq_i);
+        BOOST_CHECK_CLOSE(bhps[i], ref.value, max_d_tol);
+        BOOST_CHECK_CLOSE(bhps_dp[i], ref.value - 0.1, max_d_tol);
+    }
+}
+
 
 BOOST_AUTO_TEST_SUITE_END() // Trivial tests
 